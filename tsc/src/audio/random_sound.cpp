@@ -79,6 +79,8 @@ void cRandom_Sound::Init(void)
     m_massive_type = MASS_PASSIVE;
     m_editor_pos_z = 0.111f;
     m_camera_range = 0;
+    // fades the volume with the distance
+    m_always_active = 1;
     m_name = "Sound";
 
     m_rect.m_w = 10.0f;
@@ -383,13 +385,13 @@ void cRandom_Sound::Draw(cSurface_Request* request /* = NULL */)
     // draw color rect
     pVideo->Draw_Rect(m_col_rect.m_x - pActive_Camera->m_x, m_col_rect.m_y - pActive_Camera->m_y, m_col_rect.m_w, m_col_rect.m_h, m_editor_pos_z, &greenyellow);
     // volume reduction begin
-    cCircle_Request* circle_request = new cCircle_Request();
+    cCircle_Request* circle_request = pRenderer->Alloc<cCircle_Request>();
     pVideo->Draw_Circle(m_col_rect.m_x - pActive_Camera->m_x, m_col_rect.m_y - pActive_Camera->m_y, m_volume_reduction_begin, m_editor_pos_z - 0.0001f, &m_editor_color_volume_reduction_begin, circle_request);
     circle_request->m_line_width = 3;
     // add request
     pRenderer->Add(circle_request);
     // volume reduction end
-    circle_request = new cCircle_Request();
+    circle_request = pRenderer->Alloc<cCircle_Request>();
     pVideo->Draw_Circle(m_col_rect.m_x - pActive_Camera->m_x, m_col_rect.m_y - pActive_Camera->m_y, m_volume_reduction_end, m_editor_pos_z - 0.0002f, &m_editor_color_volume_reduction_end, circle_request);
     circle_request->m_line_width = 3;
     // add request
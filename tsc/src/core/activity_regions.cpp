@@ -0,0 +1,306 @@
+/***************************************************************************
+ * activity_regions.cpp  -  Camera based update scheduling of sprites
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "../core/activity_regions.hpp"
+#include "../core/game_core.hpp"
+#include "../objects/sprite.hpp"
+
+namespace TSC {
+
+/* *** *** *** *** *** *** *** cActivity_Entry *** *** *** *** *** *** *** *** *** *** */
+
+cActivity_Entry::cActivity_Entry(void)
+{
+    m_regions = NULL;
+    m_cell_x = 0;
+    m_cell_y = 0;
+    m_always_active = 0;
+    m_cell_index = 0;
+    m_active_index = 0;
+    m_order = 0;
+    m_type_list = -1;
+    m_type_index = 0;
+    m_type_pending = 0;
+}
+
+cActivity_Entry::cActivity_Entry(const cActivity_Entry& entry)
+{
+    m_regions = NULL;
+    m_cell_x = 0;
+    m_cell_y = 0;
+    m_always_active = 0;
+    m_cell_index = 0;
+    m_active_index = 0;
+    m_order = 0;
+    m_type_list = -1;
+    m_type_index = 0;
+    m_type_pending = 0;
+}
+
+cActivity_Entry& cActivity_Entry::operator = (const cActivity_Entry& entry)
+{
+    // keep our own registration
+    return *this;
+}
+
+/* *** *** *** *** *** *** *** cActivity_Regions *** *** *** *** *** *** *** *** *** *** */
+
+// sort by the sprite manager array position
+struct activity_order_sort {
+    bool operator()(const cSprite* a, const cSprite* b) const
+    {
+        return a->m_activity_entry.m_order < b->m_activity_entry.m_order;
+    }
+};
+
+// sort by the sprite manager type list and array position
+struct activity_type_sort {
+    bool operator()(const cSprite* a, const cSprite* b) const
+    {
+        if (a->m_activity_entry.m_type_list != b->m_activity_entry.m_type_list) {
+            return a->m_activity_entry.m_type_list < b->m_activity_entry.m_type_list;
+        }
+
+        return a->m_activity_entry.m_order < b->m_activity_entry.m_order;
+    }
+};
+
+cActivity_Regions::cActivity_Regions(float cell_size /* = 512.0f */, float margin /* = 128.0f */)
+{
+    m_cell_size = cell_size;
+    m_margin = margin;
+    m_max_range = 0.0f;
+}
+
+cActivity_Regions::~cActivity_Regions(void)
+{
+    Clear();
+}
+
+int cActivity_Regions::Get_Cell(float pos) const
+{
+    return static_cast<int>(floor(pos / m_cell_size));
+}
+
+void cActivity_Regions::Get_Range(const cSprite* sprite, float& range_x, float& range_y)
+{
+    // same as Is_In_Range
+    if (sprite->m_camera_range >= 300) {
+        range_x = static_cast<float>(sprite->m_camera_range);
+        range_y = range_x;
+    }
+    // same as Is_Visible_On_Screen
+    else {
+        range_x = (game_res_w + sprite->m_rect.m_w) * 0.5f;
+        range_y = (game_res_h + sprite->m_rect.m_h) * 0.5f;
+    }
+}
+
+void cActivity_Regions::Add(cSprite* sprite)
+{
+    if (!sprite) {
+        return;
+    }
+
+    cActivity_Entry& entry = sprite->m_activity_entry;
+
+    // already registered
+    if (entry.m_regions == this) {
+        Update(sprite);
+        return;
+    }
+    // registered elsewhere
+    if (entry.m_regions) {
+        entry.m_regions->Remove(sprite);
+    }
+
+    entry.m_regions = this;
+    entry.m_cell_x = Get_Cell(sprite->m_rect.m_x + (sprite->m_rect.m_w * 0.5f));
+    entry.m_cell_y = Get_Cell(sprite->m_rect.m_y + (sprite->m_rect.m_h * 0.5f));
+    entry.m_always_active = sprite->m_always_active;
+
+    Insert(sprite);
+}
+
+void cActivity_Regions::Remove(cSprite* sprite)
+{
+    if (!sprite || sprite->m_activity_entry.m_regions != this) {
+        return;
+    }
+
+    Erase(sprite);
+    sprite->m_activity_entry.m_regions = NULL;
+
+    const size_t active_index = sprite->m_activity_entry.m_active_index;
+
+    // do not update it anymore in this frame
+    if (active_index < m_active.size() && m_active[active_index] == sprite) {
+        m_active[active_index] = NULL;
+    }
+}
+
+void cActivity_Regions::Update(cSprite* sprite)
+{
+    cActivity_Entry& entry = sprite->m_activity_entry;
+
+    if (entry.m_regions != this) {
+        return;
+    }
+
+    const int x = Get_Cell(sprite->m_rect.m_x + (sprite->m_rect.m_w * 0.5f));
+    const int y = Get_Cell(sprite->m_rect.m_y + (sprite->m_rect.m_h * 0.5f));
+
+    // still in the same place
+    if (entry.m_always_active == sprite->m_always_active && (entry.m_always_active || (x == entry.m_cell_x && y == entry.m_cell_y))) {
+        // the camera range may have changed
+        if (!entry.m_always_active) {
+            Cell& cell = m_cells[Get_Cell_Key(x, y)];
+            float range_x, range_y;
+            Get_Range(sprite, range_x, range_y);
+
+            cell.m_range_x = std::max(cell.m_range_x, range_x);
+            cell.m_range_y = std::max(cell.m_range_y, range_y);
+            m_max_range = std::max(m_max_range, std::max(range_x, range_y));
+        }
+
+        return;
+    }
+
+    Erase(sprite);
+
+    entry.m_cell_x = x;
+    entry.m_cell_y = y;
+    entry.m_always_active = sprite->m_always_active;
+
+    Insert(sprite);
+}
+
+void cActivity_Regions::Clear(void)
+{
+    m_cells.clear();
+    m_always_active.clear();
+    m_active.clear();
+    m_max_range = 0.0f;
+}
+
+void cActivity_Regions::Insert(cSprite* sprite)
+{
+    cActivity_Entry& entry = sprite->m_activity_entry;
+
+    if (entry.m_always_active) {
+        entry.m_cell_index = m_always_active.size();
+        m_always_active.push_back(sprite);
+        return;
+    }
+
+    CellMap::iterator cell_itr = m_cells.find(Get_Cell_Key(entry.m_cell_x, entry.m_cell_y));
+
+    // new cell
+    if (cell_itr == m_cells.end()) {
+        cell_itr = m_cells.insert(CellMap::value_type(Get_Cell_Key(entry.m_cell_x, entry.m_cell_y), Cell())).first;
+        cell_itr->second.m_range_x = 0.0f;
+        cell_itr->second.m_range_y = 0.0f;
+    }
+
+    Cell& cell = cell_itr->second;
+    float range_x, range_y;
+    Get_Range(sprite, range_x, range_y);
+
+    entry.m_cell_index = cell.m_sprites.size();
+    cell.m_sprites.push_back(sprite);
+    cell.m_range_x = std::max(cell.m_range_x, range_x);
+    cell.m_range_y = std::max(cell.m_range_y, range_y);
+    m_max_range = std::max(m_max_range, std::max(range_x, range_y));
+}
+
+void cActivity_Regions::Erase(cSprite* sprite)
+{
+    cActivity_Entry& entry = sprite->m_activity_entry;
+
+    if (entry.m_always_active) {
+        Erase_From_List(m_always_active, sprite);
+        return;
+    }
+
+    CellMap::iterator cell_itr = m_cells.find(Get_Cell_Key(entry.m_cell_x, entry.m_cell_y));
+
+    if (cell_itr == m_cells.end()) {
+        return;
+    }
+
+    SpriteList& cell = cell_itr->second.m_sprites;
+    Erase_From_List(cell, sprite);
+
+    // release empty cells
+    // the range of used cells is never lowered as it only makes the cell active longer
+    if (cell.empty()) {
+        m_cells.erase(cell_itr);
+    }
+}
+
+void cActivity_Regions::Erase_From_List(SpriteList& list, cSprite* sprite)
+{
+    const size_t index = sprite->m_activity_entry.m_cell_index;
+
+    // not in this list
+    if (index >= list.size() || list[index] != sprite) {
+        return;
+    }
+
+    // move the last sprite into the position
+    cSprite* last = list.back();
+    list[index] = last;
+    last->m_activity_entry.m_cell_index = index;
+    list.pop_back();
+}
+
+const vector<cSprite*>& cActivity_Regions::Update_Active(float camera_x, float camera_y, bool by_type /* = 0 */)
+{
+    m_active.clear();
+    m_active.insert(m_active.end(), m_always_active.begin(), m_always_active.end());
+
+    for (CellMap::const_iterator cell_itr = m_cells.begin(); cell_itr != m_cells.end(); ++cell_itr) {
+        const Cell& cell = cell_itr->second;
+        const float x = static_cast<float>(static_cast<int>(static_cast<uint32_t>(cell_itr->first >> 32))) * m_cell_size;
+        const float y = static_cast<float>(static_cast<int>(static_cast<uint32_t>(cell_itr->first))) * m_cell_size;
+
+        // camera too far away
+        if (camera_x < x - cell.m_range_x - m_margin || camera_x > x + m_cell_size + cell.m_range_x + m_margin ||
+                camera_y < y - cell.m_range_y - m_margin || camera_y > y + m_cell_size + cell.m_range_y + m_margin) {
+            continue;
+        }
+
+        m_active.insert(m_active.end(), cell.m_sprites.begin(), cell.m_sprites.end());
+    }
+
+    // keep the update order of the sprite array
+    if (by_type) {
+        std::sort(m_active.begin(), m_active.end(), activity_type_sort());
+    }
+    else {
+        std::sort(m_active.begin(), m_active.end(), activity_order_sort());
+    }
+
+    // for removing without searching
+    for (size_t i = 0; i < m_active.size(); i++) {
+        m_active[i]->m_activity_entry.m_active_index = i;
+    }
+
+    return m_active;
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
@@ -0,0 +1,157 @@
+/***************************************************************************
+ * activity_regions.hpp  -  Camera based update scheduling of sprites
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TSC_ACTIVITY_REGIONS_HPP
+#define TSC_ACTIVITY_REGIONS_HPP
+
+#include "../core/global_game.hpp"
+
+namespace TSC {
+
+    class cActivity_Regions;
+
+    /* *** *** *** *** *** *** *** cActivity_Entry *** *** *** *** *** *** *** *** *** *** */
+
+    /* Registration data every sprite carries for the activity regions
+     * it is only modified by cActivity_Regions and the sprite manager
+     * copying an entry never copies the registration
+    */
+    class cActivity_Entry {
+    public:
+        cActivity_Entry(void);
+        cActivity_Entry(const cActivity_Entry& entry);
+        cActivity_Entry& operator = (const cActivity_Entry& entry);
+
+        // the regions the sprite is registered in or NULL
+        cActivity_Regions* m_regions;
+        // cell of the rect center
+        int m_cell_x;
+        int m_cell_y;
+        // if set the sprite is in the always active list instead of a cell
+        bool m_always_active;
+        // position in the cell or the always active list
+        size_t m_cell_index;
+        // position in the active list of the last Update_Active
+        size_t m_active_index;
+        // position in the sprite manager array used to keep the update order
+        int64_t m_order;
+        // type list of the sprite manager the sprite is in or -1
+        int m_type_list;
+        // position in the type list or in the pending list of the sprite manager
+        size_t m_type_index;
+        // if set the sprite waits in the pending list to be inserted into its type list
+        bool m_type_pending;
+    };
+
+    /* *** *** *** *** *** *** *** cActivity_Regions *** *** *** *** *** *** *** *** *** *** */
+
+    /* Uniform grid of the sprites sorted by their rect center
+     * Every cell remembers the biggest camera range of its sprites.
+     * A cell is active if the camera center is inside the cell expanded by
+     * this range and the margin. Only the sprites of the active cells and
+     * the always active sprites are returned for updating.
+    */
+    class cActivity_Regions {
+    public:
+        cActivity_Regions(float cell_size = 512.0f, float margin = 128.0f);
+        ~cActivity_Regions(void);
+
+        // Add the sprite with its current rect
+        void Add(cSprite* sprite);
+        // Remove the sprite
+        void Remove(cSprite* sprite);
+        /* Move the sprite into the cell of its current rect
+         * does nothing if the sprite is not registered in these regions
+        */
+        void Update(cSprite* sprite);
+        /* Forget all sprites
+         * the sprites are not accessed as they may already be deleted
+        */
+        void Clear(void);
+
+        /* Fill the active list from the given camera center
+         * the list is sorted by the entry order
+         * by_type : sort by the entry type list first
+        */
+        const vector<cSprite*>& Update_Active(float camera_x, float camera_y, bool by_type = 0);
+        /* Return the list filled by the last Update_Active
+         * removed sprites are set to NULL
+        */
+        inline const vector<cSprite*>& Get_Active(void) const
+        {
+            return m_active;
+        }
+
+        /* Return the biggest distance from the camera center a sprite can be updated at
+         * it only grows until Clear
+        */
+        inline float Get_Wake_Distance(void) const
+        {
+            return m_max_range + m_margin + m_cell_size;
+        }
+
+        // Return the number of used cells
+        inline size_t Get_Cell_Count(void) const
+        {
+            return m_cells.size();
+        }
+
+    private:
+        typedef vector<cSprite*> SpriteList;
+
+        struct Cell {
+            SpriteList m_sprites;
+            // biggest camera range of the sprites
+            float m_range_x;
+            float m_range_y;
+        };
+        typedef std::unordered_map<uint64_t, Cell> CellMap;
+
+        // Return the cell key from the given cell position
+        static inline uint64_t Get_Cell_Key(int x, int y)
+        {
+            return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) | static_cast<uint32_t>(y);
+        }
+        // Return the cell coordinate of the given position
+        int Get_Cell(float pos) const;
+        // Get the distance from the camera center the sprite updates in
+        static void Get_Range(const cSprite* sprite, float& range_x, float& range_y);
+
+        // Insert into the current entry cell or the always active list
+        void Insert(cSprite* sprite);
+        // Erase from the current entry cell or the always active list
+        void Erase(cSprite* sprite);
+        // Erase from the given list at the entry cell index
+        static void Erase_From_List(SpriteList& list, cSprite* sprite);
+
+        // cell size in pixels
+        float m_cell_size;
+        // distance added to the cell ranges
+        float m_margin;
+        // biggest camera range of all cells
+        float m_max_range;
+
+        CellMap m_cells;
+        // sprites updated independent of the camera
+        SpriteList m_always_active;
+        // sprites from the last Update_Active
+        SpriteList m_active;
+    };
+
+    /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
+
+#endif
@@ -45,6 +45,12 @@ cCamera::cCamera(cSprite_Manager* sprite_manager)
 
     m_fixed_hor_vel = 0.0f;
 
+    m_step_x = m_x;
+    m_step_y = m_y;
+    m_restore_x = m_x;
+    m_restore_y = m_y;
+    m_interpolated = 0;
+
     // default camera limit
     Reset_Limits();
 }
@@ -401,6 +407,39 @@ void cCamera::Update_Position(void) const
     }
 }
 
+void cCamera::Save_Step_Pos(void)
+{
+    m_step_x = m_x;
+    m_step_y = m_y;
+}
+
+void cCamera::Interpolate_Pos(const float alpha)
+{
+    float x = m_x;
+    float y = m_y;
+
+    if (m_interpolated || !Interpolate_Step_Pos(x, y, m_step_x, m_step_y, alpha)) {
+        return;
+    }
+
+    m_restore_x = m_x;
+    m_restore_y = m_y;
+    m_x = x;
+    m_y = y;
+    m_interpolated = 1;
+}
+
+void cCamera::Restore_Pos(void)
+{
+    if (!m_interpolated) {
+        return;
+    }
+
+    m_x = m_restore_x;
+    m_y = m_restore_y;
+    m_interpolated = 0;
+}
+
 /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
 
 } // namespace TSC
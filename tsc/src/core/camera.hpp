@@ -104,6 +104,15 @@ namespace TSC {
         // update if position changed
         void Update_Position(void) const;
 
+        // Remember the position at the start of a fixed simulation step
+        void Save_Step_Pos(void);
+        /* Move between the step start position and the current position for drawing
+         * Restore_Pos must be called before the next update
+        */
+        void Interpolate_Pos(const float alpha);
+        // Restore the position from before Interpolate_Pos
+        void Restore_Pos(void);
+
         // the parent sprite manager
         cSprite_Manager* m_sprite_manager;
         // position
@@ -118,6 +127,13 @@ namespace TSC {
         // fixed horizontal scrolling velocity
         float m_fixed_hor_vel;
 
+        // position at the start of the last fixed simulation step
+        float m_step_x, m_step_y;
+        // position before Interpolate_Pos
+        float m_restore_x, m_restore_y;
+        // set while drawn at the interpolated position
+        bool m_interpolated;
+
         // default limits
         static const GL_rect m_default_limits;
     };
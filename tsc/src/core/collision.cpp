@@ -121,6 +121,41 @@ cObjectCollision::~cObjectCollision(void)
     //
 }
 
+// released collision objects, the next pointer is stored in the released memory
+static void* collision_free_list = NULL;
+static size_t collision_free_count = 0;
+// maximum released collision objects kept for reuse
+static const size_t collision_free_max = 4096;
+
+void* cObjectCollision::operator new(size_t size)
+{
+    if (size != sizeof(cObjectCollision) || !collision_free_list) {
+        return ::operator new(size);
+    }
+
+    void* ptr = collision_free_list;
+    collision_free_list = *static_cast<void**>(ptr);
+    collision_free_count--;
+
+    return ptr;
+}
+
+void cObjectCollision::operator delete(void* ptr, size_t size)
+{
+    if (!ptr) {
+        return;
+    }
+
+    if (size != sizeof(cObjectCollision) || collision_free_count >= collision_free_max) {
+        ::operator delete(ptr);
+        return;
+    }
+
+    *static_cast<void**>(ptr) = collision_free_list;
+    collision_free_list = ptr;
+    collision_free_count++;
+}
+
 void cObjectCollision::Set_Direction(const cSprite* base, const cSprite* col)
 {
     m_direction = Get_Collision_Direction(base, col);
@@ -35,6 +35,12 @@ namespace TSC {
         cObjectCollision(void);
         ~cObjectCollision(void);
 
+        /* Collision objects are created and deleted many times each frame
+         * so released memory is kept in a free list for reuse
+        */
+        static void* operator new(size_t size);
+        static void operator delete(void* ptr, size_t size);
+
         /* Set the collision direction
          * base - the base sprite
          * col - the colliding sprite
@@ -0,0 +1,134 @@
+/***************************************************************************
+ * dispatch_benchmark.cpp  -  Timing of the sprite update dispatch
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "../core/dispatch_benchmark.hpp"
+#include "../core/game_core.hpp"
+#include "../core/sprite_manager.hpp"
+#include "../level/level.hpp"
+
+using namespace std;
+
+namespace TSC {
+
+/* *** *** *** *** *** *** *** cDispatch_Benchmark *** *** *** *** *** *** *** *** *** *** */
+
+// frames measured before switching the mode
+static const unsigned int dispatch_benchmark_block = 50;
+
+cDispatch_Benchmark::cDispatch_Benchmark(void)
+{
+    m_frames = 0;
+    m_warmup = 0;
+    m_mode_frames[0] = 0;
+    m_mode_frames[1] = 0;
+    m_mode = 1;
+
+    for (unsigned int mode = 0; mode < 2; mode++) {
+        for (unsigned int part = 0; part < DISPATCH_PART_AMOUNT; part++) {
+            m_time[mode][part] = 0;
+        }
+    }
+}
+
+void cDispatch_Benchmark::Start(unsigned int frames)
+{
+    *this = cDispatch_Benchmark();
+
+    m_frames = frames;
+    // skip the level fade in
+    m_warmup = 100;
+}
+
+void cDispatch_Benchmark::Update(void)
+{
+    if (!m_frames) {
+        return;
+    }
+
+    if (m_warmup) {
+        m_warmup--;
+
+        // nothing measured yet
+        if (m_warmup) {
+            return;
+        }
+
+        m_mode = 0;
+        cSprite_Manager::m_type_dispatch = 0;
+        return;
+    }
+
+    // time of the last frame was added to the current mode
+    m_mode_frames[m_mode]++;
+
+    // done
+    if (m_mode_frames[0] >= m_frames && m_mode_frames[1] >= m_frames) {
+        Print();
+
+        m_frames = 0;
+        m_mode = 0;
+        cSprite_Manager::m_type_dispatch = 0;
+        game_exit = 1;
+        return;
+    }
+
+    // switch the mode in blocks to spread other load evenly
+    if (m_mode_frames[m_mode] % dispatch_benchmark_block == 0 || m_mode_frames[m_mode] >= m_frames) {
+        if (m_mode_frames[!m_mode] < m_frames) {
+            m_mode = !m_mode;
+            cSprite_Manager::m_type_dispatch = m_mode != 0;
+        }
+    }
+}
+
+void cDispatch_Benchmark::Print(void) const
+{
+    const char* mode_names[2] = {"array order", "type order "};
+    const char* part_names[DISPATCH_PART_AMOUNT] = {"update", "update late", "draw"};
+    double totals[2] = {0.0, 0.0};
+
+    cout << "Sprite dispatch benchmark";
+
+    if (pActive_Level) {
+        cout << " of " << pActive_Level->Get_Level_Name() << " with " << pActive_Level->m_sprite_manager->size() << " objects";
+    }
+
+    cout << endl << "Microseconds per frame over " << m_frames << " frames" << endl;
+
+    for (unsigned int mode = 0; mode < 2; mode++) {
+        cout << mode_names[mode];
+
+        for (unsigned int part = 0; part < DISPATCH_PART_AMOUNT; part++) {
+            const double time = static_cast<double>(m_time[mode][part]) / 1000.0 / m_mode_frames[mode];
+
+            totals[mode] += time;
+            cout << "  " << part_names[part] << " " << time;
+        }
+
+        cout << "  total " << totals[mode] << endl;
+    }
+
+    if (totals[1] > 0.0) {
+        cout << "type order speedup " << totals[0] / totals[1] << endl;
+    }
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+cDispatch_Benchmark* pDispatch_Benchmark = NULL;
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
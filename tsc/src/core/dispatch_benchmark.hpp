@@ -0,0 +1,92 @@
+/***************************************************************************
+ * dispatch_benchmark.hpp  -  Timing of the sprite update dispatch
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TSC_DISPATCH_BENCHMARK_HPP
+#define TSC_DISPATCH_BENCHMARK_HPP
+
+#include "../core/global_basic.hpp"
+
+namespace TSC {
+
+    /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+    // Measured parts of the level sprite dispatch
+    enum DispatchPart {
+        DISPATCH_UPDATE = 0,
+        DISPATCH_UPDATE_LATE = 1,
+        DISPATCH_DRAW = 2,
+        DISPATCH_PART_AMOUNT = 3
+    };
+
+    /* *** *** *** *** *** *** *** cDispatch_Benchmark *** *** *** *** *** *** *** *** *** *** */
+
+    /* Compares the array order and the type order dispatch of the level sprites
+     * The mode is switched every few frames while the level is running.
+     * When enough frames are measured the result is printed and the game exits.
+    */
+    class cDispatch_Benchmark {
+    public:
+        cDispatch_Benchmark(void);
+
+        // Start measuring the given number of frames for every mode
+        void Start(unsigned int frames);
+        /* Switch the dispatch mode if needed
+         * must be called once every level frame
+        */
+        void Update(void);
+
+        // Start timing a part
+        inline void Begin(void)
+        {
+            if (m_frames && !m_warmup) {
+                m_part_start = std::chrono::steady_clock::now();
+            }
+        }
+        // Stop timing the given part
+        inline void End(DispatchPart part)
+        {
+            if (m_frames && !m_warmup) {
+                m_time[m_mode][part] += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_part_start).count();
+            }
+        }
+
+    private:
+        // Print the result
+        void Print(void) const;
+
+        // frames to measure for every mode or 0 if not running
+        unsigned int m_frames;
+        // frames before measuring starts
+        unsigned int m_warmup;
+        // measured frames of every mode
+        unsigned int m_mode_frames[2];
+        // current mode, 1 is the type order
+        unsigned int m_mode;
+
+        // time in nanoseconds of every mode and part
+        uint64_t m_time[2][DISPATCH_PART_AMOUNT];
+        std::chrono::steady_clock::time_point m_part_start;
+    };
+
+    /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+// Sprite dispatch benchmark
+    extern cDispatch_Benchmark* pDispatch_Benchmark;
+
+    /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
+
+#endif
@@ -75,6 +75,11 @@ cFramerate::cFramerate(void)
     m_max_elapsed_ticks = 100;
     m_speed_factor = 0.1f;
     m_force_speed_factor = 0.0f;
+    m_fixed_step = 0;
+    m_step_speed_factor = 1.0f;
+    m_step_accumulator = 0.0f;
+    m_interpolation = 0.0f;
+    m_frame_speed_factor = m_speed_factor;
     m_perf_last_ticks = 0;
 
     // create performance timers
@@ -171,6 +176,8 @@ void cFramerate::Reset(void)
     m_fps_average = 0;
     m_fps_average_framedelay = m_last_ticks;
     m_frames_counted = 0;
+    m_step_accumulator = 0.0f;
+    m_interpolation = 0.0f;
 
     // reset performance timer
     for (Performance_Timer_List::iterator itr = m_perf_timer.begin(); itr != m_perf_timer.end(); ++itr) {
@@ -188,6 +195,47 @@ void cFramerate::Set_Fixed_Speedfacor(const float val)
     m_force_speed_factor = val;
 }
 
+void cFramerate::Set_Fixed_Step(const unsigned int steps_per_second)
+{
+    m_fixed_step = steps_per_second > 0;
+
+    if (m_fixed_step) {
+        m_step_speed_factor = static_cast<float>(speedfactor_fps) / steps_per_second;
+    }
+
+    m_step_accumulator = 0.0f;
+    m_interpolation = 0.0f;
+}
+
+unsigned int cFramerate::Begin_Steps(void)
+{
+    // more steps would make slow frames even slower
+    const unsigned int max_steps = 5;
+    unsigned int steps = 0;
+
+    m_frame_speed_factor = m_speed_factor;
+    m_step_accumulator += m_speed_factor;
+
+    while (m_step_accumulator >= m_step_speed_factor && steps < max_steps) {
+        m_step_accumulator -= m_step_speed_factor;
+        steps++;
+    }
+
+    // too slow : drop the remaining time
+    if (m_step_accumulator >= m_step_speed_factor) {
+        m_step_accumulator = 0.0f;
+    }
+
+    m_interpolation = m_step_accumulator / m_step_speed_factor;
+
+    return steps;
+}
+
+void cFramerate::End_Steps(void)
+{
+    m_speed_factor = m_frame_speed_factor;
+}
+
 /* *** *** *** *** *** *** *** helper functions *** *** *** *** *** *** *** *** *** *** */
 
 void Correct_Frame_Time(const unsigned int fps)
@@ -209,6 +257,18 @@ bool Is_Frame_Time(const unsigned int fps)
     return 1;
 }
 
+bool Interpolate_Step_Pos(float& x, float& y, const float step_x, const float step_y, const float alpha)
+{
+    // teleported
+    if (fabs(x - step_x) > 150.0f || fabs(y - step_y) > 150.0f) {
+        return 0;
+    }
+
+    x = step_x + ((x - step_x) * alpha);
+    y = step_y + ((y - step_y) * alpha);
+    return 1;
+}
+
 /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
 
 cFramerate* pFramerate = NULL;
@@ -69,6 +69,17 @@ namespace TSC {
         */
         void Set_Fixed_Speedfacor(const float val);
 
+        /* Simulate the game with the given steps per second
+         * if 0 the game is simulated once every frame with the measured speed factor
+        */
+        void Set_Fixed_Step(const unsigned int steps_per_second);
+        /* Return the number of fixed steps to simulate in this frame
+         * the steps must use the step speed factor until End_Steps
+        */
+        unsigned int Begin_Steps(void);
+        // Restore the speed factor of the frame
+        void End_Steps(void);
+
         // target fps for speed factor calculations
         float m_fps_target;
         // current fps
@@ -100,6 +111,19 @@ namespace TSC {
         // fixed speed factor value
         float m_force_speed_factor;
 
+        // if set the game is simulated in steps of the same length
+        bool m_fixed_step;
+        // speed factor of one fixed step
+        float m_step_speed_factor;
+        // speed factor not simulated yet
+        float m_step_accumulator;
+        /* part of the next step already elapsed from 0 to 1
+         * used to draw between the last two simulated states
+        */
+        float m_interpolation;
+        // measured speed factor of the frame while simulating the steps
+        float m_frame_speed_factor;
+
         // ## performance values ##
         // ticks since last section
         uint32_t m_perf_last_ticks;
@@ -117,6 +141,12 @@ namespace TSC {
 // Return true if the next frame is ready for the given framerate
     bool Is_Frame_Time(const unsigned int fps);
 
+    /* Set the position between the step start position and the given position
+     * alpha : the part of the movement from 0 to 1
+     * returns 0 and keeps the position if too far away to be a movement
+    */
+    bool Interpolate_Step_Pos(float& x, float& y, const float step_x, const float step_y, const float alpha);
+
     /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
 
 // Framerate class
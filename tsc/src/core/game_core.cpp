@@ -26,6 +26,7 @@
 #include "../scene/scene.hpp"
 #include "../video/loading_screen.hpp"
 #include "../video/renderer.hpp"
+#include "../video/img_manager.hpp"
 #include "../level/level.hpp"
 #include "../core/sprite_manager.hpp"
 #include "../overworld/overworld.hpp"
@@ -62,6 +63,8 @@ const int game_res_h = 600;
 
 bool game_debug = 0;
 bool game_debug_performance = 0;
+bool game_random_seed_set = 0;
+uint32_t game_random_seed = 0;
 
 sf::Event input_event;
 
@@ -478,6 +481,9 @@ void Preload_Images(bool draw_gui /* = 0 */)
             Loading_Screen_Draw();
         }
     }
+
+    // pack the small images into atlas textures
+    pImage_Manager->Build_Atlases();
 }
 
 void Preload_Sounds(bool draw_gui /* = 0 */)
@@ -49,6 +49,9 @@ namespace TSC {
 // global debugging
     extern bool game_debug;
     extern bool game_debug_performance;
+// random seed given on the command line
+    extern bool game_random_seed_set;
+    extern uint32_t game_random_seed;
 
 // Game Input event
     extern sf::Event input_event;
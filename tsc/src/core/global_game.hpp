@@ -180,6 +180,7 @@ namespace TSC {
 #define USER_WORLD_DIR "worlds"
 #define USER_CAMPAIGN_DIR "campaigns"
 #define USER_IMGCACHE_DIR "images"
+#define USER_LEVELCACHE_DIR "levels"
 #define USER_SCRIPTING_DIR "scripting"
 
     /* *** *** *** *** *** *** *** forward declarations *** *** *** *** *** *** *** *** *** *** */
@@ -429,6 +430,7 @@ namespace TSC {
     class cPath;
     class cPath_State;
     class cRect_Request;
+    class cRender_Request_Advanced;
     class cSave_Level_Object;
     class cSaved_Texture;
     class cSize_Float;
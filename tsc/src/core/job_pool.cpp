@@ -0,0 +1,192 @@
+/***************************************************************************
+ * job_pool.cpp  -  Work stealing thread pool
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "../core/job_pool.hpp"
+
+using namespace std;
+
+namespace TSC {
+
+/* *** *** *** *** *** *** *** cJob_Pool *** *** *** *** *** *** *** *** *** *** */
+
+// more threads do not help with the small jobs of a frame
+static const int job_pool_max_threads = 15;
+
+cJob_Pool::cJob_Pool(int thread_count /* = -1 */)
+{
+    m_generation = 0;
+    m_remaining = 0;
+    m_exit = 0;
+
+    if (thread_count < 0) {
+        thread_count = static_cast<int>(boost::thread::hardware_concurrency()) - 1;
+    }
+    if (thread_count > job_pool_max_threads) {
+        thread_count = job_pool_max_threads;
+    }
+    if (thread_count < 0) {
+        thread_count = 0;
+    }
+
+    for (int i = 0; i <= thread_count; i++) {
+        m_queues.push_back(new Job_Queue());
+    }
+
+    for (int i = 1; i <= thread_count; i++) {
+        m_threads.push_back(new boost::thread(&cJob_Pool::Worker, this, static_cast<unsigned int>(i)));
+    }
+}
+
+cJob_Pool::~cJob_Pool(void)
+{
+    {
+        boost::lock_guard<boost::mutex> lock(m_mutex);
+        m_exit = 1;
+    }
+    m_wake.notify_all();
+
+    for (vector<boost::thread*>::iterator itr = m_threads.begin(); itr != m_threads.end(); ++itr) {
+        (*itr)->join();
+        delete *itr;
+    }
+
+    for (vector<Job_Queue*>::iterator itr = m_queues.begin(); itr != m_queues.end(); ++itr) {
+        delete *itr;
+    }
+}
+
+void cJob_Pool::Run(size_t count, size_t grain, const Job_Function& func)
+{
+    if (!count) {
+        return;
+    }
+    if (!grain) {
+        grain = 1;
+    }
+
+    // not worth waking the workers
+    if (m_threads.empty() || count <= grain) {
+        func(0, count);
+        return;
+    }
+
+    size_t jobs = 0;
+
+    // spread the chunks over all queues
+    for (size_t begin = 0; begin < count; begin += grain) {
+        Job job;
+        job.m_func = &func;
+        job.m_begin = begin;
+        job.m_end = min(begin + grain, count);
+
+        Job_Queue* queue = m_queues[jobs % m_queues.size()];
+        boost::lock_guard<boost::mutex> lock(queue->m_mutex);
+        queue->m_jobs.push_back(job);
+        jobs++;
+    }
+
+    {
+        boost::lock_guard<boost::mutex> lock(m_mutex);
+        m_remaining += jobs;
+        m_generation++;
+    }
+    m_wake.notify_all();
+
+    // help until no job is left to take
+    Work(0);
+
+    // wait for the jobs still running on other threads
+    boost::unique_lock<boost::mutex> lock(m_mutex);
+
+    while (m_remaining) {
+        m_done.wait(lock);
+    }
+}
+
+void cJob_Pool::Worker(unsigned int index)
+{
+    unsigned int generation = 0;
+
+    while (1) {
+        {
+            boost::unique_lock<boost::mutex> lock(m_mutex);
+
+            while (!m_exit && generation == m_generation) {
+                m_wake.wait(lock);
+            }
+
+            if (m_exit) {
+                return;
+            }
+
+            generation = m_generation;
+        }
+
+        Work(index);
+    }
+}
+
+bool cJob_Pool::Get_Job(unsigned int index, Job& job)
+{
+    // newest own job
+    {
+        Job_Queue* queue = m_queues[index];
+        boost::lock_guard<boost::mutex> lock(queue->m_mutex);
+
+        if (!queue->m_jobs.empty()) {
+            job = queue->m_jobs.back();
+            queue->m_jobs.pop_back();
+            return 1;
+        }
+    }
+
+    // steal the oldest job of the other queues
+    for (size_t i = 1; i < m_queues.size(); i++) {
+        Job_Queue* queue = m_queues[(index + i) % m_queues.size()];
+        boost::lock_guard<boost::mutex> lock(queue->m_mutex);
+
+        if (!queue->m_jobs.empty()) {
+            job = queue->m_jobs.front();
+            queue->m_jobs.pop_front();
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+void cJob_Pool::Work(unsigned int index)
+{
+    Job job;
+
+    while (Get_Job(index, job)) {
+        (*job.m_func)(job.m_begin, job.m_end);
+
+        boost::lock_guard<boost::mutex> lock(m_mutex);
+        m_remaining--;
+
+        if (!m_remaining) {
+            m_done.notify_all();
+        }
+    }
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+cJob_Pool* pJob_Pool = NULL;
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
@@ -0,0 +1,104 @@
+/***************************************************************************
+ * job_pool.hpp  -  Work stealing thread pool
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TSC_JOB_POOL_HPP
+#define TSC_JOB_POOL_HPP
+
+#include "../core/global_basic.hpp"
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include <deque>
+
+namespace TSC {
+
+    /* *** *** *** *** *** *** *** cJob_Pool *** *** *** *** *** *** *** *** *** *** */
+
+    /* Runs a function over an index range on several threads
+     * Every thread has its own job queue. The range is split into chunks
+     * which are spread over all queues. A thread takes the newest job of its
+     * own queue and steals the oldest job of another queue if its own is empty.
+     * The calling thread works on the jobs as well and Run returns when all
+     * jobs are done.
+    */
+    class cJob_Pool {
+    public:
+        // called with the index range [begin, end)
+        typedef std::function<void (size_t begin, size_t end)> Job_Function;
+
+        /* thread_count : worker threads besides the calling thread
+         * if negative one less than the available cores
+        */
+        cJob_Pool(int thread_count = -1);
+        ~cJob_Pool(void);
+
+        /* Call func for all indexes in [0, count) and wait until done
+         * grain : indexes handled by one job
+         * Runs on the calling thread only if there are no workers or
+         * not more than one job.
+        */
+        void Run(size_t count, size_t grain, const Job_Function& func);
+
+        // Return the number of threads running jobs including the calling thread
+        inline unsigned int Get_Thread_Count(void) const
+        {
+            return static_cast<unsigned int>(m_queues.size());
+        }
+
+    private:
+        struct Job {
+            const Job_Function* m_func;
+            size_t m_begin;
+            size_t m_end;
+        };
+
+        struct Job_Queue {
+            boost::mutex m_mutex;
+            std::deque<Job> m_jobs;
+        };
+
+        // Worker thread main loop
+        void Worker(unsigned int index);
+        // Take a job from the own queue or steal one from another queue
+        bool Get_Job(unsigned int index, Job& job);
+        // Run all jobs that can be found
+        void Work(unsigned int index);
+
+        // queue 0 is used by the calling thread
+        vector<Job_Queue*> m_queues;
+        vector<boost::thread*> m_threads;
+
+        // protects the fields below
+        boost::mutex m_mutex;
+        // signaled when new jobs are available or on exit
+        boost::condition_variable m_wake;
+        // signaled when the last job is done
+        boost::condition_variable m_done;
+        // increased by every Run
+        unsigned int m_generation;
+        // jobs of the current Run not done yet
+        size_t m_remaining;
+        bool m_exit;
+    };
+
+    /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+// Job Pool
+    extern cJob_Pool* pJob_Pool;
+
+    /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
+
+#endif
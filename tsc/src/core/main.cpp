@@ -38,10 +38,16 @@
 #include "../user/savegame/savegame.hpp"
 #include "../input/keyboard.hpp"
 #include "../video/renderer.hpp"
+#include "../video/gl_state.hpp"
 #include "../video/loading_screen.hpp"
 #include "../video/img_settings.hpp"
 #include "../video/img_manager.hpp"
 #include "../core/i18n.hpp"
+#include "../core/math/random.hpp"
+#include "../core/dispatch_benchmark.hpp"
+#include "../core/number_benchmark.hpp"
+#include "../core/job_pool.hpp"
+#include "../level/level_preloader.hpp"
 #include "../gui/generic.hpp"
 #include "../gui/game_console.hpp"
 #include "../gui/debug_window.hpp"
@@ -95,6 +101,8 @@ int main(int argc, char** argv)
 
     // convert arguments to a vector string
     vector<std::string> arguments(argv, argv + argc);
+    // frames measured by the dispatch benchmark
+    unsigned int benchmark_frames = 0;
 
     if (argc >= 2) {
         for (unsigned int i = 1; i < arguments.size(); i++) {
@@ -107,6 +115,9 @@ int main(int argc, char** argv)
                 cout << "-d, --debug\tEnable debug modes with the options : game performance" << endl;
                 cout << "-l, --level\tLoad the given level" << endl;
                 cout << "-w, --world\tLoad the given world" << endl;
+                cout << "-s, --seed\tSeed the random number generators with the given number" << endl;
+                cout << "-b, --benchmark\tCompare the sprite dispatch modes for the given number of frames and exit, use after --level" << endl;
+                cout << "--benchmark-numbers\tCompare the number conversion with the stream conversion for the given number of iterations and exit" << endl;
                 return EXIT_SUCCESS;
             }
             // version
@@ -148,6 +159,39 @@ int main(int argc, char** argv)
                     }
                 }
             }
+            // random seed
+            else if (arguments[i] == "--seed" || arguments[i] == "-s") {
+                // no value
+                if (i + 1 >= arguments.size()) {
+                    cerr << arguments[i] << " requires a value" << endl;
+                    return EXIT_FAILURE;
+                }
+
+                game_random_seed_set = 1;
+                game_random_seed = string_to_uint(arguments[i + 1]);
+                i++;
+            }
+            // sprite dispatch benchmark
+            else if (arguments[i] == "--benchmark" || arguments[i] == "-b") {
+                // no value
+                if (i + 1 >= arguments.size()) {
+                    cerr << arguments[i] << " requires a value" << endl;
+                    return EXIT_FAILURE;
+                }
+
+                benchmark_frames = string_to_uint(arguments[i + 1]);
+                i++;
+            }
+            // number conversion benchmark
+            else if (arguments[i] == "--benchmark-numbers") {
+                // no value
+                if (i + 1 >= arguments.size()) {
+                    cerr << arguments[i] << " requires a value" << endl;
+                    return EXIT_FAILURE;
+                }
+
+                return Number_Benchmark(string_to_uint(arguments[i + 1])) ? EXIT_SUCCESS : EXIT_FAILURE;
+            }
             // level loading is handled later
             else if (arguments[i] == "--level" || arguments[i] == "-l") {
                 // skip
@@ -171,6 +215,10 @@ int main(int argc, char** argv)
         // initialize everything
         Init_Game();
 
+        if (benchmark_frames) {
+            pDispatch_Benchmark->Start(benchmark_frames);
+        }
+
         // command line level entering
         if (argc > 2 && (arguments[1] == "--level" || arguments[1] == "-l") && !arguments[2].empty()) {
             Game_Action = GA_ENTER_LEVEL;
@@ -201,6 +249,7 @@ int main(int argc, char** argv)
                 // update
                 Update_Game();
                 // draw
+                Begin_Draw_Interpolation();
                 Draw_Game();
 
                 // render
@@ -209,6 +258,7 @@ int main(int argc, char** argv)
 #else
                 pVideo->Render();
 #endif
+                End_Draw_Interpolation();
 
                 // update speedfactor
                 pFramerate->Update();
@@ -244,8 +294,13 @@ namespace TSC {
 
 void Init_Game(void)
 {
-    // init random number generator
-    srand(static_cast<unsigned int>(time(NULL)));
+    // init random number generators
+    const uint32_t random_seed = game_random_seed_set ? game_random_seed : static_cast<uint32_t>(time(NULL));
+
+    Seed_Random_Streams(random_seed);
+    // remaining rand() users
+    srand(random_seed);
+    debug_print("Random seed %u\n", random_seed);
 
     // Init Stage 1 - core classes
     debug_print("Initializing resource manager and core classes\n");
@@ -255,6 +310,9 @@ void Init_Game(void)
     pFramerate = new cFramerate();
     pRenderer = new cRenderQueue(200);
     pRenderer_current = new cRenderQueue(200);
+    pGL_State = new cGL_State();
+    pDispatch_Benchmark = new cDispatch_Benchmark();
+    pJob_Pool = new cJob_Pool();
     pImage_Manager = new cImage_Manager();
     pSound_Manager = new cSound_Manager();
     pSettingsParser = new cImage_Settings_Parser();
@@ -273,6 +331,7 @@ void Init_Game(void)
     pResource_Manager->Init_User_Directory();
     // framerate init
     pFramerate->Init();
+    pFramerate->Set_Fixed_Step(pPreferences->m_fixed_step_rate);
     // audio init
     pAudio->Init();
     // video init
@@ -289,6 +348,7 @@ void Init_Game(void)
 
     debug_print("Loading levels\n");
     pLevel_Manager = new cLevel_Manager();
+    pLevel_Preloader = new cLevel_Preloader();
     // set the first animation manager available
     pActive_Animation_Manager = pActive_Level->m_animation_manager;
     // set the first active sprite manager available
@@ -345,6 +405,12 @@ void Exit_Game(void)
         pPreferences->Save();
     }
 
+    // stop reading levels in the background
+    if (pLevel_Preloader) {
+        delete pLevel_Preloader;
+        pLevel_Preloader = NULL;
+    }
+
     pLevel_Manager->Unload();
     pMenuCore->m_handler->m_level->Unload();
 
@@ -448,6 +514,21 @@ void Exit_Game(void)
         pRenderer_current = NULL;
     }
 
+    if (pGL_State) {
+        delete pGL_State;
+        pGL_State = NULL;
+    }
+
+    if (pDispatch_Benchmark) {
+        delete pDispatch_Benchmark;
+        pDispatch_Benchmark = NULL;
+    }
+
+    if (pJob_Pool) {
+        delete pJob_Pool;
+        pJob_Pool = NULL;
+    }
+
     if (pVideo) {
         delete pVideo;
         pVideo = NULL;
@@ -604,12 +685,6 @@ void Update_Game(void)
     pAudio->Resume_Music();
     pAudio->Update();
 
-    // performance measuring
-    pFramerate->m_perf_last_ticks = TSC_GetTicks();
-
-    // ## hud
-    gp_hud->Update();
-
     // ## game console
     gp_game_console->Update();
 
@@ -617,6 +692,38 @@ void Update_Game(void)
     gp_debug_window->Update();
 
     // ## update
+    if (pFramerate->m_fixed_step) {
+        const unsigned int steps = pFramerate->Begin_Steps();
+
+        for (unsigned int i = 0; i < steps && !game_exit; i++) {
+            // a step running its own frame loop sets the measured speed factor
+            pFramerate->m_speed_factor = pFramerate->m_step_speed_factor;
+
+            Save_Step_Positions();
+            Update_Game_Step();
+        }
+
+        pFramerate->End_Steps();
+    }
+    else {
+        Update_Game_Step();
+    }
+
+    // ## level preloading
+    pLevel_Preloader->Update();
+
+    // gui
+    Gui_Handle_Time();
+}
+
+void Update_Game_Step(void)
+{
+    // performance measuring
+    pFramerate->m_perf_last_ticks = TSC_GetTicks();
+
+    // ## hud
+    gp_hud->Update();
+
     if (Game_Mode == MODE_LEVEL) {
         pLevel_Manager->Update();
     }
@@ -632,9 +739,70 @@ void Update_Game(void)
     else if (Game_Mode == MODE_SCENE) {
         pActive_Scene->Update();
     }
+}
 
-    // gui
-    Gui_Handle_Time();
+// sprite manager interpolated by Begin_Draw_Interpolation
+static cSprite_Manager* interpolated_sprite_manager = NULL;
+
+// Return the sprite manager of the game mode if it is drawn interpolated
+static cSprite_Manager* Get_Step_Sprite_Manager(void)
+{
+    // the editor shows the real positions
+    if (editor_enabled) {
+        return NULL;
+    }
+
+    if (Game_Mode == MODE_LEVEL && pActive_Level) {
+        return pActive_Level->m_sprite_manager;
+    }
+    else if (Game_Mode == MODE_OVERWORLD && pActive_Overworld) {
+        return pActive_Overworld->m_sprite_manager;
+    }
+
+    return NULL;
+}
+
+void Save_Step_Positions(void)
+{
+    cSprite_Manager* sprite_manager = Get_Step_Sprite_Manager();
+
+    if (!sprite_manager) {
+        return;
+    }
+
+    sprite_manager->Save_Step_Positions();
+    pActive_Player->Save_Step_Pos();
+    pActive_Camera->Save_Step_Pos();
+}
+
+void Begin_Draw_Interpolation(void)
+{
+    if (!pFramerate->m_fixed_step) {
+        return;
+    }
+
+    interpolated_sprite_manager = Get_Step_Sprite_Manager();
+
+    if (!interpolated_sprite_manager) {
+        return;
+    }
+
+    const float alpha = pFramerate->m_interpolation;
+
+    interpolated_sprite_manager->Interpolate_Positions(alpha);
+    interpolated_sprite_manager->Interpolate_Position(pActive_Player, alpha);
+    pActive_Camera->Interpolate_Pos(alpha);
+}
+
+void End_Draw_Interpolation(void)
+{
+    if (!interpolated_sprite_manager) {
+        return;
+    }
+
+    interpolated_sprite_manager->Restore_Positions();
+    pActive_Camera->Restore_Pos();
+    interpolated_sprite_manager = NULL;
 }
 
 void Draw_Game(void)
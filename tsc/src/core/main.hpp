@@ -39,11 +39,27 @@ namespace TSC {
     */
     void Update_Game(void);
 
+    /* Update the game mode for one simulation step
+     * called by Update_Game once or for every fixed step
+    */
+    void Update_Game_Step(void);
+
+    /* Remember the object positions at the start of a fixed step
+     * used to draw between the last two steps
+    */
+    void Save_Step_Positions(void);
+
     /* Draw current game state
      * Should be called continuously from Game Loop.
     */
     void Draw_Game(void);
 
+    /* Draw the objects between their last two fixed step positions
+     * until End_Draw_Interpolation is called after rendering
+    */
+    void Begin_Draw_Interpolation(void);
+    void End_Draw_Interpolation(void);
+
     /* This constant holds the entire string shown at the
      * credits screen. It is implemented in a file generated
      * during the build process (from credits.cpp.in). */
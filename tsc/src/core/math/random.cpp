@@ -0,0 +1,97 @@
+/***************************************************************************
+ * random.cpp  -  Seedable random number streams
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "../../core/math/random.hpp"
+
+namespace TSC {
+
+/* splitmix64 step
+ * used to expand a seed into well distributed state values
+*/
+static uint64_t Split_Mix(uint64_t& state)
+{
+    uint64_t value = (state += 0x9E3779B97F4A7C15ull);
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+    return value ^ (value >> 31);
+}
+
+/* *** *** *** *** *** *** *** cRandom *** *** *** *** *** *** *** *** *** *** */
+
+cRandom::cRandom(uint32_t seed /* = 0 */)
+{
+    Seed(seed);
+}
+
+void cRandom::Seed(uint32_t seed)
+{
+    uint64_t state = seed;
+
+    const uint64_t value_1 = Split_Mix(state);
+    const uint64_t value_2 = Split_Mix(state);
+
+    m_state[0] = static_cast<uint32_t>(value_1);
+    m_state[1] = static_cast<uint32_t>(value_1 >> 32);
+    m_state[2] = static_cast<uint32_t>(value_2);
+    m_state[3] = static_cast<uint32_t>(value_2 >> 32);
+
+    // the state must not be all zero
+    if (!m_state[0] && !m_state[1] && !m_state[2] && !m_state[3]) {
+        m_state[0] = 1;
+    }
+}
+
+void cRandom::Fill_Floats(float* values, size_t count, float min, float max)
+{
+    const float range = max - min;
+
+    for (size_t i = 0; i < count; i++) {
+        values[i] = min + range * Get_Float();
+    }
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+static cRandom random_streams[RANDOM_STREAM_AMOUNT];
+static uint32_t random_seed_last = 0;
+
+void Seed_Random_Streams(uint32_t seed)
+{
+    random_seed_last = seed;
+
+    for (unsigned int i = 0; i < RANDOM_STREAM_AMOUNT; i++) {
+        // every stream gets its own sequence
+        random_streams[i].Seed(seed + i * 0x9E3779B9u);
+    }
+}
+
+uint32_t Get_Random_Seed(void)
+{
+    return random_seed_last;
+}
+
+cRandom& Get_Random_Stream(RandomStream stream)
+{
+    return random_streams[stream];
+}
+
+void Fill_Random_Floats(float* values, size_t count, float min, float max, RandomStream stream /* = RANDOM_STREAM_PARTICLES */)
+{
+    random_streams[stream].Fill_Floats(values, count, min, max);
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
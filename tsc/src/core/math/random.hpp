@@ -0,0 +1,109 @@
+/***************************************************************************
+ * random.hpp  -  Seedable random number streams
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TSC_RANDOM_HPP
+#define TSC_RANDOM_HPP
+
+#include "../../core/global_basic.hpp"
+
+namespace TSC {
+
+    /* *** *** *** *** *** *** *** RandomStream *** *** *** *** *** *** *** *** *** *** */
+
+    // independent random number streams of the subsystems
+    enum RandomStream {
+        RANDOM_STREAM_GENERAL = 0,
+        RANDOM_STREAM_PARTICLES = 1,
+        RANDOM_STREAM_ENEMIES = 2,
+        RANDOM_STREAM_SCRIPTING = 3,
+        RANDOM_STREAM_AMOUNT = 4
+    };
+
+    /* *** *** *** *** *** *** *** cRandom *** *** *** *** *** *** *** *** *** *** */
+
+    /* xoshiro128** random number generator
+     * not thread safe, every thread needs its own instance
+    */
+    class cRandom {
+    public:
+        cRandom(uint32_t seed = 0);
+
+        // Reset the state from the given seed
+        void Seed(uint32_t seed);
+
+        // Return the next 32 bit value
+        inline uint32_t Next(void)
+        {
+            const uint32_t result = Rotate_Left(m_state[1] * 5, 7) * 9;
+            const uint32_t temp = m_state[1] << 9;
+
+            m_state[2] ^= m_state[0];
+            m_state[3] ^= m_state[1];
+            m_state[1] ^= m_state[2];
+            m_state[0] ^= m_state[3];
+            m_state[2] ^= temp;
+            m_state[3] = Rotate_Left(m_state[3], 11);
+
+            return result;
+        }
+
+        // Return a floating point value in [0, 1)
+        inline float Get_Float(void)
+        {
+            // the upper 24 bits fit exactly into the float mantissa
+            return static_cast<float>(Next() >> 8) * (1.0f / 16777216.0f);
+        }
+        // Return a floating point value between the given values
+        inline float Get_Float(float min, float max)
+        {
+            return min + (max - min) * Get_Float();
+        }
+        // Return an integer value in [0, range) or 0 if range is 0
+        inline unsigned int Get_Int(unsigned int range)
+        {
+            // multiply shift range reduction avoids the slow modulo
+            return static_cast<unsigned int>((static_cast<uint64_t>(Next()) * range) >> 32);
+        }
+        // Fill the array with floating point values between the given values
+        void Fill_Floats(float* values, size_t count, float min, float max);
+
+    private:
+        static inline uint32_t Rotate_Left(uint32_t value, int bits)
+        {
+            return (value << bits) | (value >> (32 - bits));
+        }
+
+        uint32_t m_state[4];
+    };
+
+    /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+    /* Seed all streams with values derived from the given seed
+     * the same seed always gives the same values
+    */
+    void Seed_Random_Streams(uint32_t seed);
+    // Return the seed of the last Seed_Random_Streams call
+    uint32_t Get_Random_Seed(void);
+    // Return the random number stream
+    cRandom& Get_Random_Stream(RandomStream stream);
+
+    // Fill the array with floating point values between the given values from the stream
+    void Fill_Random_Floats(float* values, size_t count, float min, float max, RandomStream stream = RANDOM_STREAM_PARTICLES);
+
+    /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
+
+#endif
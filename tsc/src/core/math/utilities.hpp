@@ -19,6 +19,7 @@
 
 #include "../../core/global_basic.hpp"
 #include "../../core/global_game.hpp"
+#include "../../core/math/random.hpp"
 
 namespace TSC {
 
@@ -37,9 +38,15 @@ namespace TSC {
     }
 
 // return a random floating point value between the given values
-    inline float Get_Random_Float(float min, float max)
+    inline float Get_Random_Float(float min, float max, RandomStream stream = RANDOM_STREAM_GENERAL)
     {
-        return min + (max - min) * static_cast<float>(rand()) / static_cast<float>(RAND_MAX);
+        return Get_Random_Stream(stream).Get_Float(min, max);
+    }
+
+// return a random integer value in [0, range)
+    inline unsigned int Get_Random_Int(unsigned int range, RandomStream stream = RANDOM_STREAM_GENERAL)
+    {
+        return Get_Random_Stream(stream).Get_Int(range);
     }
 
 // Checks if number is power of 2 and if not returns the next power of two size
@@ -0,0 +1,114 @@
+/***************************************************************************
+ * number_benchmark.cpp  -  Timing of the string to number conversion
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "../core/number_benchmark.hpp"
+#include "../core/property_helper.hpp"
+
+using namespace std;
+
+namespace TSC {
+
+/* *** *** *** *** *** *** *** Number benchmark *** *** *** *** *** *** *** *** *** *** */
+
+// values as found in level, world and savegame files
+static const char* number_benchmark_values[] = {
+    "0", "1", "-1", "42", "128", "-64", "1024", "65535", "2147483647", "-2147483648",
+    "0.5", "-0.5", "0.75", "1.25", "3.141593", "-12.375", "450.5", "2048.125", "0.000100", "100000.000000",
+    "12.5", " 7", "+3", "1e3", "2.5e-2", "007", "-0", "10.", ".5", "abc"
+};
+
+// the conversion used before
+template <class T> static T stream_to_number(const std::string& str)
+{
+    T num = 0;
+    std::istringstream iss(str);
+    iss >> std::dec >> num;
+    return num;
+}
+
+// Converts all values with the stream and the fast version
+template <class T> struct Number_Benchmark_Type {
+    typedef T (*Convert_Function)(const std::string& str);
+
+    static bool Run(const char* name, Convert_Function convert, const vector<std::string>& values, unsigned int iterations)
+    {
+        bool equal = 1;
+
+        for (vector<std::string>::const_iterator itr = values.begin(); itr != values.end(); ++itr) {
+            const T stream_value = stream_to_number<T>(*itr);
+            const T value = convert(*itr);
+
+            // compare the bits to see a different rounding or sign of zero
+            if (memcmp(&stream_value, &value, sizeof(T)) != 0) {
+                cout << name << " differs for \"" << *itr << "\": " << value << " instead of " << stream_value << endl;
+                equal = 0;
+            }
+        }
+
+        // sum the results so the conversions are not optimized away
+        volatile T sink = 0;
+
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+        for (unsigned int i = 0; i < iterations; i++) {
+            for (vector<std::string>::const_iterator itr = values.begin(); itr != values.end(); ++itr) {
+                sink = sink + stream_to_number<T>(*itr);
+            }
+        }
+
+        const uint64_t stream_time = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+        start = std::chrono::steady_clock::now();
+
+        for (unsigned int i = 0; i < iterations; i++) {
+            for (vector<std::string>::const_iterator itr = values.begin(); itr != values.end(); ++itr) {
+                sink = sink + convert(*itr);
+            }
+        }
+
+        const uint64_t time = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+        const double conversions = static_cast<double>(iterations) * values.size();
+
+        cout << name << "  stream " << stream_time / conversions << "  fast " << time / conversions;
+
+        if (time) {
+            cout << "  speedup " << static_cast<double>(stream_time) / time;
+        }
+
+        cout << endl;
+
+        return equal;
+    }
+};
+
+bool Number_Benchmark(unsigned int iterations)
+{
+    vector<std::string> values(number_benchmark_values, number_benchmark_values + sizeof(number_benchmark_values) / sizeof(number_benchmark_values[0]));
+    bool equal = 1;
+
+    cout << "Number conversion benchmark" << endl << "Nanoseconds per conversion over " << iterations << " iterations of " << values.size() << " values" << endl;
+
+    equal &= Number_Benchmark_Type<int>::Run("int    ", string_to_int, values, iterations);
+    equal &= Number_Benchmark_Type<unsigned int>::Run("uint   ", string_to_uint, values, iterations);
+    equal &= Number_Benchmark_Type<uint64_t>::Run("int64  ", string_to_int64, values, iterations);
+    equal &= Number_Benchmark_Type<long>::Run("long   ", string_to_long, values, iterations);
+    equal &= Number_Benchmark_Type<float>::Run("float  ", string_to_float, values, iterations);
+    equal &= Number_Benchmark_Type<double>::Run("double ", string_to_double, values, iterations);
+
+    return equal;
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
@@ -0,0 +1,37 @@
+/***************************************************************************
+ * number_benchmark.hpp  -  Timing of the string to number conversion
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TSC_NUMBER_BENCHMARK_HPP
+#define TSC_NUMBER_BENCHMARK_HPP
+
+#include "../core/global_basic.hpp"
+
+namespace TSC {
+
+    /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+    /* Compare the string_to_* functions with the stream conversion
+     * Converts a set of typical level file values the given number of times
+     * with both, prints the time per conversion and the values which do not
+     * give the same result.
+     * returns false if a result differs
+    */
+    bool Number_Benchmark(unsigned int iterations);
+
+    /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
+
+#endif
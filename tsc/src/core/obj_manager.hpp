@@ -21,8 +21,39 @@
 
 namespace TSC {
 
+    /* *** *** *** *** *** cObject_Manager_Entry *** *** *** *** *** *** *** *** *** *** *** *** */
+
+    /* Array position of an object in its manager
+     * only used by managers returning it from Get_Entry
+     * copying an entry never copies the registration
+    */
+    class cObject_Manager_Entry {
+    public:
+        cObject_Manager_Entry(void)
+            : m_manager(NULL), m_index(0), m_deleted(0) {};
+        cObject_Manager_Entry(const cObject_Manager_Entry& entry)
+            : m_manager(NULL), m_index(0), m_deleted(0) {};
+        cObject_Manager_Entry& operator = (const cObject_Manager_Entry& entry)
+        {
+            // keep our own registration
+            return *this;
+        }
+
+        // the manager the object is in or NULL
+        const void* m_manager;
+        // position in the objects array
+        size_t m_index;
+        // if set the object is removed from the array with the next Compact
+        bool m_deleted;
+    };
+
     /* *** *** *** *** *** cObject_Manager *** *** *** *** *** *** *** *** *** *** *** *** */
 
+    /* If the manager returns an entry from Get_Entry deleting an object only
+     * marks it as deleted and it stays in the objects array until Compact
+     * which removes all deleted objects with one pass over the array.
+     * Without an entry objects are searched and erased at once.
+    */
     template<class T> class cObject_Manager {
     public:
         cObject_Manager(void) {};
@@ -31,25 +62,31 @@ namespace TSC {
         //  Add the given object
         virtual void Add(T* obj)
         {
+            cObject_Manager_Entry* entry = Get_Entry(obj);
+
+            if (entry) {
+                entry->m_manager = this;
+                entry->m_index = objects.size();
+                entry->m_deleted = 0;
+            }
+
             objects.push_back(obj);
         }
 
         // Delete the object from given array number
         virtual bool Delete(size_t array_num, bool delete_data = 1)
         {
-            // if in vector
-            if (array_num < objects.size()) {
-                objects.erase(objects.begin() + array_num);
-            }
-
-            if (delete_data) {
-                delete objects[array_num];
+            // not in vector
+            if (array_num >= objects.size()) {
+                return 0;
             }
 
-            return 1;
+            return Delete(objects[array_num], delete_data);
         }
 
-        // Delete the given object
+        /* Delete the given object
+         * with an entry the data is deleted by the next Compact
+        */
         virtual bool Delete(T* obj, bool delete_data = 1)
         {
             // empty object
@@ -57,13 +94,28 @@ namespace TSC {
                 return 0;
             }
 
+            cObject_Manager_Entry* entry = Get_Entry(obj);
+
+            // mark as deleted without searching
+            if (entry && entry->m_manager == this) {
+                // already deleted
+                if (entry->m_deleted) {
+                    return 0;
+                }
+
+                entry->m_deleted = 1;
+                m_deleted_objects.push_back(std::make_pair(obj, delete_data));
+
+                return 1;
+            }
+
             // get iterator
             typename vector<T*>::iterator itr = std::find(objects.begin(), objects.end(), obj);
 
             // available in vector
             if (itr != objects.end()) {
                 // erase
-                objects.erase(itr);
+                Update_Entries(objects.erase(itr) - objects.begin());
             }
 
             if (delete_data) {
@@ -73,9 +125,58 @@ namespace TSC {
             return 1;
         }
 
+        /* Remove the deleted objects from the array
+         * and delete their data if requested
+        */
+        void Compact(void)
+        {
+            // nothing deleted
+            if (m_deleted_objects.empty()) {
+                return;
+            }
+
+            size_t count = 0;
+
+            for (size_t i = 0; i < objects.size(); i++) {
+                T* obj = objects[i];
+                cObject_Manager_Entry* entry = Get_Entry(obj);
+
+                if (entry) {
+                    // added to another manager since it was deleted without its data
+                    if (entry->m_manager != this) {
+                        continue;
+                    }
+
+                    if (entry->m_deleted) {
+                        entry->m_manager = NULL;
+                        entry->m_deleted = 0;
+                        continue;
+                    }
+
+                    entry->m_index = count;
+                }
+
+                objects[count] = obj;
+                count++;
+            }
+
+            objects.resize(count);
+
+            for (typename Deleted_List::iterator itr = m_deleted_objects.begin(); itr != m_deleted_objects.end(); ++itr) {
+                if (itr->second) {
+                    delete itr->first;
+                }
+            }
+
+            m_deleted_objects.clear();
+        }
+
         // Delete all objects
         virtual void Delete_All(void)
         {
+            // objects deleted without their data are not deleted here
+            Compact();
+
             for (typename vector<T*>::iterator itr = objects.begin(); itr != objects.end(); ++itr) {
                 delete *itr;
             }
@@ -141,6 +242,17 @@ namespace TSC {
                 return -1;
             }
 
+            const cObject_Manager_Entry* entry = Get_Entry(obj);
+
+            // from the entry
+            if (entry && entry->m_manager == this) {
+                if (entry->m_deleted) {
+                    return -1;
+                }
+
+                return static_cast<int>(entry->m_index);
+            }
+
             typename vector<T*>::const_iterator itr_obj = std::find(objects.begin(), objects.end(), obj);
 
             // not in vector
@@ -164,6 +276,30 @@ namespace TSC {
         }
 
         vector<T*> objects;
+
+    protected:
+        // Return the entry of the object or NULL if objects are searched
+        virtual cObject_Manager_Entry* Get_Entry(T* obj) const
+        {
+            return NULL;
+        }
+
+        // Set the entry positions from the given array position after the array was reordered
+        void Update_Entries(size_t start = 0)
+        {
+            for (size_t i = start; i < objects.size(); i++) {
+                cObject_Manager_Entry* entry = Get_Entry(objects[i]);
+
+                if (entry && entry->m_manager == this) {
+                    entry->m_index = i;
+                }
+            }
+        }
+
+    private:
+        typedef vector<std::pair<T*, bool> > Deleted_List;
+        // deleted objects waiting for Compact and if their data is deleted
+        Deleted_List m_deleted_objects;
     };
 
     /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
@@ -18,6 +18,7 @@
 #include "../core/i18n.hpp"
 #include "../video/color.hpp"
 #include "../objects/sprite.hpp"
+#include <limits>
 
 namespace TSC {
 
@@ -269,43 +270,150 @@ std::string float_to_string(double value, int prec /* = 6 */, bool keep_zeros /*
 template <class T> bool from_string(T& t, const std::string& s, std::ios_base &(*f)(std::ios_base&))
 {
     std::istringstream iss(s);
+    iss.imbue(std::locale::classic());
     return !(iss >> f >> t).fail();
 }
 
-int string_to_int(const std::string& str)
+/* Locale independent number parsing
+ * The plain numbers found in level and savegame files are parsed without a
+ * stream. These are an optional '-' and digits, for floating point values
+ * with one '.' like Is_Valid_Number() accepts. Anything else like whitespace,
+ * a '+' sign, an exponent or trailing characters is left to the stream
+ * helper so the result is always the same.
+*/
+struct Scanned_Number {
+    bool m_negative;
+    // all digits without the point
+    uint64_t m_mantissa;
+    // power of ten of the last digit
+    int m_exponent;
+};
+
+// Returns false if the string has to be parsed by the stream helper
+static bool scan_number(const std::string& str, bool accept_floating_point, Scanned_Number& num)
+{
+    const char* pos = str.c_str();
+    const char* end = pos + str.size();
+    unsigned int digits = 0;
+    bool point = 0;
+    bool any_digit = 0;
+
+    num.m_negative = 0;
+    num.m_mantissa = 0;
+    num.m_exponent = 0;
+
+    if (pos != end && *pos == '-') {
+        num.m_negative = 1;
+        pos++;
+    }
+
+    for (; pos != end; pos++) {
+        const char c = *pos;
+
+        if (c >= '0' && c <= '9') {
+            any_digit = 1;
+
+            if (point) {
+                num.m_exponent--;
+            }
+            // leading zeros do not count
+            if (!num.m_mantissa && c == '0') {
+                continue;
+            }
+            // more digits could overflow
+            if (digits == 19) {
+                return 0;
+            }
+
+            num.m_mantissa = num.m_mantissa * 10 + static_cast<uint64_t>(c - '0');
+            digits++;
+        }
+        else if (c == '.' && !point) {
+            // the stream stops integers at the point
+            if (!accept_floating_point) {
+                break;
+            }
+
+            point = 1;
+        }
+        else {
+            return 0;
+        }
+    }
+
+    // trailing zeros after the point do not change the value
+    while (num.m_exponent < 0 && num.m_mantissa && !(num.m_mantissa % 10)) {
+        num.m_mantissa /= 10;
+        num.m_exponent++;
+    }
+
+    return any_digit;
+}
+
+template <class T> static T parse_integer(const std::string& str)
 {
-    int num = 0;
+    Scanned_Number scanned;
+
+    if (scan_number(str, 0, scanned)) {
+        const uint64_t max_value = static_cast<uint64_t>(std::numeric_limits<T>::max());
+
+        if (!scanned.m_negative && scanned.m_mantissa <= max_value) {
+            return static_cast<T>(scanned.m_mantissa);
+        }
+        // out of range or negative unsigned values are handled by the stream
+        if (scanned.m_negative && std::numeric_limits<T>::is_signed && scanned.m_mantissa <= max_value + 1) {
+            if (!scanned.m_mantissa) {
+                return 0;
+            }
+
+            return static_cast<T>(-static_cast<int64_t>(scanned.m_mantissa - 1) - 1);
+        }
+    }
+
+    T num = 0;
     // use helper
-    from_string<int>(num, str, std::dec);
+    from_string<T>(num, str, std::dec);
     return num;
 }
 
+// Powers of ten which are exact as float and double
+static const float exact_pow_of_10_float[] = {1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f};
+static const double exact_pow_of_10_double[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+                                                1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+                                               };
+
+int string_to_int(const std::string& str)
+{
+    return parse_integer<int>(str);
+}
+
 unsigned int string_to_uint(const std::string& str)
 {
-    unsigned int num = 0;
-    // use helper
-    from_string<unsigned int>(num, str, std::dec);
-    return num;
+    return parse_integer<unsigned int>(str);
 }
 
 uint64_t string_to_int64(const std::string& str)
 {
-    uint64_t num = 0;
-    // use helper
-    from_string<uint64_t>(num, str, std::dec);
-    return num;
+    return parse_integer<uint64_t>(str);
 }
 
 long string_to_long(const std::string& str)
 {
-    long num = 0;
-    // use helper
-    from_string<long>(num, str, std::dec);
-    return num;
+    return parse_integer<long>(str);
 }
 
 float string_to_float(const std::string& str)
 {
+    Scanned_Number scanned;
+
+    /* If the mantissa and the power of ten are exact a single division
+     * is correctly rounded like the stream result
+    */
+    if (scan_number(str, 1, scanned) && scanned.m_mantissa <= (1 << 24) && scanned.m_exponent >= -10) {
+        const float num = static_cast<float>(scanned.m_mantissa) / exact_pow_of_10_float[-scanned.m_exponent];
+        return scanned.m_negative ? -num : num;
+    }
+
     float num = 0.0f;
     // use helper
     from_string<float>(num, str, std::dec);
@@ -314,6 +422,14 @@ float string_to_float(const std::string& str)
 
 double string_to_double(const std::string& str)
 {
+    Scanned_Number scanned;
+
+    // see string_to_float
+    if (scan_number(str, 1, scanned) && scanned.m_mantissa <= (static_cast<uint64_t>(1) << 53) && scanned.m_exponent >= -22) {
+        const double num = static_cast<double>(scanned.m_mantissa) / exact_pow_of_10_double[-scanned.m_exponent];
+        return scanned.m_negative ? -num : num;
+    }
+
     double num = 0.0;
     // use helper
     from_string<double>(num, str, std::dec);
@@ -0,0 +1,332 @@
+/***************************************************************************
+ * spatial_hash.cpp  -  Uniform grid broadphase for sprite collisions
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "../core/spatial_hash.hpp"
+#include "../objects/sprite.hpp"
+
+namespace TSC {
+
+/* *** *** *** *** *** *** *** cSpatial_Hash_Entry *** *** *** *** *** *** *** *** *** *** */
+
+cSpatial_Hash_Entry::cSpatial_Hash_Entry(void)
+{
+    m_hash = NULL;
+    m_cell_x1 = 0;
+    m_cell_y1 = 0;
+    m_cell_x2 = -1;
+    m_cell_y2 = -1;
+    m_oversized = 0;
+    m_query_id = 0;
+}
+
+cSpatial_Hash_Entry::cSpatial_Hash_Entry(const cSpatial_Hash_Entry& entry)
+{
+    m_hash = NULL;
+    m_cell_x1 = 0;
+    m_cell_y1 = 0;
+    m_cell_x2 = -1;
+    m_cell_y2 = -1;
+    m_oversized = 0;
+    m_query_id = 0;
+}
+
+cSpatial_Hash_Entry& cSpatial_Hash_Entry::operator = (const cSpatial_Hash_Entry& entry)
+{
+    // keep our own registration
+    return *this;
+}
+
+/* *** *** *** *** *** *** *** cSpatial_Hash *** *** *** *** *** *** *** *** *** *** */
+
+unsigned int cSpatial_Hash::m_last_generation = 0;
+
+cSpatial_Hash::cSpatial_Hash(float cell_size /* = 256.0f */, unsigned int max_cells /* = 64 */)
+{
+    m_cell_size = cell_size;
+    m_max_cells = max_cells;
+    m_query_id = 0;
+    m_generation = Create_Generation();
+    m_change_sprite = NULL;
+    m_change_start = m_generation;
+}
+
+cSpatial_Hash::~cSpatial_Hash(void)
+{
+    Clear();
+}
+
+int cSpatial_Hash::Get_Cell(float pos) const
+{
+    return static_cast<int>(floor(pos / m_cell_size));
+}
+
+void cSpatial_Hash::Add(cSprite* sprite)
+{
+    if (!sprite) {
+        return;
+    }
+
+    cSpatial_Hash_Entry& entry = sprite->m_spatial_hash_entry;
+
+    // already registered
+    if (entry.m_hash == this) {
+        Update(sprite);
+        return;
+    }
+    // registered elsewhere
+    if (entry.m_hash) {
+        entry.m_hash->Remove(sprite);
+    }
+
+    entry.m_hash = this;
+    entry.m_cell_x1 = Get_Cell(sprite->m_col_rect.m_x);
+    entry.m_cell_y1 = Get_Cell(sprite->m_col_rect.m_y);
+    entry.m_cell_x2 = Get_Cell(sprite->m_col_rect.m_x + sprite->m_col_rect.m_w);
+    entry.m_cell_y2 = Get_Cell(sprite->m_col_rect.m_y + sprite->m_col_rect.m_h);
+    entry.m_query_id = 0;
+
+    Insert_Cells(sprite);
+    Changed(sprite);
+}
+
+void cSpatial_Hash::Remove(cSprite* sprite)
+{
+    if (!sprite || sprite->m_spatial_hash_entry.m_hash != this) {
+        return;
+    }
+
+    Erase_Cells(sprite);
+    sprite->m_spatial_hash_entry.m_hash = NULL;
+    Changed(sprite);
+}
+
+void cSpatial_Hash::Update(cSprite* sprite)
+{
+    cSpatial_Hash_Entry& entry = sprite->m_spatial_hash_entry;
+
+    if (entry.m_hash != this) {
+        return;
+    }
+
+    const int x1 = Get_Cell(sprite->m_col_rect.m_x);
+    const int y1 = Get_Cell(sprite->m_col_rect.m_y);
+    const int x2 = Get_Cell(sprite->m_col_rect.m_x + sprite->m_col_rect.m_w);
+    const int y2 = Get_Cell(sprite->m_col_rect.m_y + sprite->m_col_rect.m_h);
+
+    // still in the same cells
+    if (x1 == entry.m_cell_x1 && y1 == entry.m_cell_y1 && x2 == entry.m_cell_x2 && y2 == entry.m_cell_y2) {
+        return;
+    }
+
+    Erase_Cells(sprite);
+
+    entry.m_cell_x1 = x1;
+    entry.m_cell_y1 = y1;
+    entry.m_cell_x2 = x2;
+    entry.m_cell_y2 = y2;
+
+    Insert_Cells(sprite);
+    Changed(sprite);
+}
+
+void cSpatial_Hash::Clear(void)
+{
+    m_cells.clear();
+    m_oversized.clear();
+    Changed(NULL);
+}
+
+bool cSpatial_Hash::Is_Unchanged_Since(unsigned int generation, const cSprite* sprite) const
+{
+    if (generation == m_generation) {
+        return 1;
+    }
+
+    // only changed by the given sprite
+    if (sprite && m_change_sprite == sprite && m_change_start <= generation && generation < m_generation) {
+        return 1;
+    }
+
+    return 0;
+}
+
+unsigned int cSpatial_Hash::Create_Generation(void)
+{
+    return ++m_last_generation;
+}
+
+void cSpatial_Hash::Changed(const cSprite* sprite)
+{
+    // a different sprite starts a new change run
+    if (!sprite || sprite != m_change_sprite) {
+        m_change_sprite = sprite;
+        m_change_start = m_generation;
+    }
+
+    m_generation = Create_Generation();
+}
+
+void cSpatial_Hash::Insert_Cells(cSprite* sprite)
+{
+    cSpatial_Hash_Entry& entry = sprite->m_spatial_hash_entry;
+
+    const uint64_t cell_count = static_cast<uint64_t>(entry.m_cell_x2 - entry.m_cell_x1 + 1) * static_cast<uint64_t>(entry.m_cell_y2 - entry.m_cell_y1 + 1);
+
+    // too big for the cells
+    if (cell_count > m_max_cells) {
+        entry.m_oversized = 1;
+        m_oversized.push_back(sprite);
+        return;
+    }
+
+    entry.m_oversized = 0;
+
+    for (int x = entry.m_cell_x1; x <= entry.m_cell_x2; x++) {
+        for (int y = entry.m_cell_y1; y <= entry.m_cell_y2; y++) {
+            m_cells[Get_Cell_Key(x, y)].push_back(sprite);
+        }
+    }
+}
+
+void cSpatial_Hash::Erase_Cells(cSprite* sprite)
+{
+    cSpatial_Hash_Entry& entry = sprite->m_spatial_hash_entry;
+
+    if (entry.m_oversized) {
+        SpriteList::iterator itr = std::find(m_oversized.begin(), m_oversized.end(), sprite);
+
+        if (itr != m_oversized.end()) {
+            *itr = m_oversized.back();
+            m_oversized.pop_back();
+        }
+
+        return;
+    }
+
+    for (int x = entry.m_cell_x1; x <= entry.m_cell_x2; x++) {
+        for (int y = entry.m_cell_y1; y <= entry.m_cell_y2; y++) {
+            CellMap::iterator cell_itr = m_cells.find(Get_Cell_Key(x, y));
+
+            if (cell_itr == m_cells.end()) {
+                continue;
+            }
+
+            SpriteList& cell = cell_itr->second;
+            SpriteList::iterator itr = std::find(cell.begin(), cell.end(), sprite);
+
+            if (itr != cell.end()) {
+                *itr = cell.back();
+                cell.pop_back();
+            }
+
+            // release empty cells
+            if (cell.empty()) {
+                m_cells.erase(cell_itr);
+            }
+        }
+    }
+}
+
+void cSpatial_Hash::Query_Add(cSprite* sprite, SpriteList& result) const
+{
+    // already returned by this query
+    if (sprite->m_spatial_hash_entry.m_query_id == m_query_id) {
+        return;
+    }
+
+    sprite->m_spatial_hash_entry.m_query_id = m_query_id;
+    result.push_back(sprite);
+}
+
+void cSpatial_Hash::Query(const GL_rect& rect, vector<cSprite*>& result) const
+{
+    m_query_id++;
+
+    // on overflow reset the query identifiers of all sprites
+    if (m_query_id == 0) {
+        for (CellMap::const_iterator cell_itr = m_cells.begin(); cell_itr != m_cells.end(); ++cell_itr) {
+            for (SpriteList::const_iterator itr = cell_itr->second.begin(); itr != cell_itr->second.end(); ++itr) {
+                (*itr)->m_spatial_hash_entry.m_query_id = 0;
+            }
+        }
+
+        for (SpriteList::const_iterator itr = m_oversized.begin(); itr != m_oversized.end(); ++itr) {
+            (*itr)->m_spatial_hash_entry.m_query_id = 0;
+        }
+
+        m_query_id = 1;
+    }
+
+    const int x1 = Get_Cell(rect.m_x);
+    const int y1 = Get_Cell(rect.m_y);
+    const int x2 = Get_Cell(rect.m_x + rect.m_w);
+    const int y2 = Get_Cell(rect.m_y + rect.m_h);
+
+    const uint64_t cell_count = static_cast<uint64_t>(x2 - x1 + 1) * static_cast<uint64_t>(y2 - y1 + 1);
+
+    // less used cells than covered ones
+    if (cell_count > m_cells.size()) {
+        for (CellMap::const_iterator cell_itr = m_cells.begin(); cell_itr != m_cells.end(); ++cell_itr) {
+            const int x = static_cast<int>(static_cast<uint32_t>(cell_itr->first >> 32));
+            const int y = static_cast<int>(static_cast<uint32_t>(cell_itr->first));
+
+            if (x < x1 || x > x2 || y < y1 || y > y2) {
+                continue;
+            }
+
+            for (SpriteList::const_iterator itr = cell_itr->second.begin(); itr != cell_itr->second.end(); ++itr) {
+                Query_Add(*itr, result);
+            }
+        }
+    }
+    else {
+        for (int x = x1; x <= x2; x++) {
+            for (int y = y1; y <= y2; y++) {
+                CellMap::const_iterator cell_itr = m_cells.find(Get_Cell_Key(x, y));
+
+                if (cell_itr == m_cells.end()) {
+                    continue;
+                }
+
+                for (SpriteList::const_iterator itr = cell_itr->second.begin(); itr != cell_itr->second.end(); ++itr) {
+                    Query_Add(*itr, result);
+                }
+            }
+        }
+    }
+
+    for (SpriteList::const_iterator itr = m_oversized.begin(); itr != m_oversized.end(); ++itr) {
+        Query_Add(*itr, result);
+    }
+}
+
+/* *** *** *** *** *** *** *** cCollision_Cache *** *** *** *** *** *** *** *** *** *** */
+
+cCollision_Cache::cCollision_Cache(void)
+{
+    m_sprite_manager = NULL;
+    m_hash_generation = 0;
+    m_static_generation = 0;
+}
+
+void cCollision_Cache::Clear(void)
+{
+    m_sprite_manager = NULL;
+    m_objects.clear();
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
@@ -0,0 +1,171 @@
+/***************************************************************************
+ * spatial_hash.hpp  -  Uniform grid broadphase for sprite collisions
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TSC_SPATIAL_HASH_HPP
+#define TSC_SPATIAL_HASH_HPP
+
+#include "../core/global_game.hpp"
+#include "../core/math/rect.hpp"
+
+namespace TSC {
+
+    class cSpatial_Hash;
+
+    /* *** *** *** *** *** *** *** cSpatial_Hash_Entry *** *** *** *** *** *** *** *** *** *** */
+
+    /* Registration data every sprite carries for the spatial hash
+     * it is only modified by cSpatial_Hash
+     * copying an entry never copies the registration
+    */
+    class cSpatial_Hash_Entry {
+    public:
+        cSpatial_Hash_Entry(void);
+        cSpatial_Hash_Entry(const cSpatial_Hash_Entry& entry);
+        cSpatial_Hash_Entry& operator = (const cSpatial_Hash_Entry& entry);
+
+        // the hash the sprite is registered in or NULL
+        cSpatial_Hash* m_hash;
+        // covered cell range
+        int m_cell_x1;
+        int m_cell_y1;
+        int m_cell_x2;
+        int m_cell_y2;
+        // if set the sprite is in the oversized list instead of the cells
+        bool m_oversized;
+        // identifier of the last query which returned the sprite
+        unsigned int m_query_id;
+    };
+
+    /* *** *** *** *** *** *** *** cSpatial_Hash *** *** *** *** *** *** *** *** *** *** */
+
+    /* Uniform grid over the sprite collision rects
+     * Sprites are stored in every cell their collision rect touches.
+     * Sprites covering more than the maximum cell count are kept in
+     * a separate list which is returned by every query.
+    */
+    class cSpatial_Hash {
+    public:
+        cSpatial_Hash(float cell_size = 256.0f, unsigned int max_cells = 64);
+        ~cSpatial_Hash(void);
+
+        // Add the sprite with its current collision rect
+        void Add(cSprite* sprite);
+        // Remove the sprite
+        void Remove(cSprite* sprite);
+        /* Move the sprite into the cells of its current collision rect
+         * does nothing if the sprite is not registered in this hash
+        */
+        void Update(cSprite* sprite);
+        /* Forget all sprites
+         * the sprites are not accessed as they may already be deleted
+        */
+        void Clear(void);
+
+        /* Add all sprites with a cell touching the given rect to the list
+         * every sprite is only added once
+         * the exact intersection has to be checked by the caller
+        */
+        void Query(const GL_rect& rect, vector<cSprite*>& result) const;
+
+        // Return the number of used cells
+        inline size_t Get_Cell_Count(void) const
+        {
+            return m_cells.size();
+        }
+
+        // Return the generation of the last cell change
+        inline unsigned int Get_Generation(void) const
+        {
+            return m_generation;
+        }
+        /* Return true if no cells changed since the given generation
+         * changes of the given sprite are ignored
+        */
+        bool Is_Unchanged_Since(unsigned int generation, const cSprite* sprite) const;
+
+        // Return a new generation unique for all hashes
+        static unsigned int Create_Generation(void);
+
+    private:
+        typedef vector<cSprite*> SpriteList;
+        typedef std::unordered_map<uint64_t, SpriteList> CellMap;
+
+        // Return the cell key from the given cell position
+        static inline uint64_t Get_Cell_Key(int x, int y)
+        {
+            return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) | static_cast<uint32_t>(y);
+        }
+        // Return the cell coordinate of the given position
+        int Get_Cell(float pos) const;
+
+        // Insert into the cells of the current entry range
+        void Insert_Cells(cSprite* sprite);
+        // Erase from the cells of the current entry range
+        void Erase_Cells(cSprite* sprite);
+        // Add the sprite if it was not yet returned by the current query
+        void Query_Add(cSprite* sprite, SpriteList& result) const;
+        // Start a new generation after a cell change of the given sprite
+        void Changed(const cSprite* sprite);
+
+        // cell size in pixels
+        float m_cell_size;
+        // maximum cells a sprite can be stored in
+        unsigned int m_max_cells;
+
+        CellMap m_cells;
+        // sprites exceeding the maximum cell count
+        SpriteList m_oversized;
+        // current query identifier
+        mutable unsigned int m_query_id;
+
+        // current generation
+        unsigned int m_generation;
+        // sprite which did all changes since m_change_start
+        const cSprite* m_change_sprite;
+        // generation before the first change of m_change_sprite
+        unsigned int m_change_start;
+        // last generation given out
+        static unsigned int m_last_generation;
+    };
+
+    /* *** *** *** *** *** *** *** cCollision_Cache *** *** *** *** *** *** *** *** *** *** */
+
+    /* Broadphase objects found around a sprite
+     * reused by cSprite_Manager::Get_Colliding_Objects while the query rect is
+     * inside the cached rect and no other object changed its cells
+    */
+    class cCollision_Cache {
+    public:
+        cCollision_Cache(void);
+
+        // Forget the cached objects
+        void Clear(void);
+
+        // the sprite manager the objects are from or NULL if invalid
+        const cSprite_Manager* m_sprite_manager;
+        // the expanded query rect
+        GL_rect m_rect;
+        // spatial hash and static collision generation of the objects
+        unsigned int m_hash_generation;
+        unsigned int m_static_generation;
+        // all objects possibly touching m_rect
+        vector<cSprite*> m_objects;
+    };
+
+    /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
+
+#endif
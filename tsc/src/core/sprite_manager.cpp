@@ -16,10 +16,13 @@
 
 #include "../core/sprite_manager.hpp"
 #include "../core/game_core.hpp"
+#include "../core/camera.hpp"
 #include "../level/level_player.hpp"
 #include "../input/mouse.hpp"
 #include "../overworld/world_player.hpp"
 #include "../enemies/enemy.hpp"
+#include "../core/job_pool.hpp"
+#include "../core/framerate.hpp"
 #include "../core/global_basic.hpp"
 
 using namespace std;
@@ -28,12 +31,38 @@ namespace TSC {
 
 /* *** *** *** *** *** *** cSprite_Manager *** *** *** *** *** *** *** *** *** *** *** */
 
+// border added around cached collision query rects
+const float cSprite_Manager::m_collision_cache_border = 32.0f;
+bool cSprite_Manager::m_type_dispatch = 0;
+bool cSprite_Manager::m_parallel_think = 1;
+uint32_t cSprite_Manager::m_think_frame = 0;
+
+// objects thinking in one job
+static const size_t think_job_grain = 16;
+
+// sort by the array order
+struct activity_order_less {
+    bool operator()(const cSprite* a, const cSprite* b) const
+    {
+        return a->m_activity_entry.m_order < b->m_activity_entry.m_order;
+    }
+};
+
 cSprite_Manager::cSprite_Manager(unsigned int reserve_items /* = 2000 */, unsigned int zpos_items /* = 100 */)
     : cObject_Manager<cSprite>()
 {
     objects.reserve(reserve_items);
 
     m_max_uid_mark = 1; // UID 0 is reserved for the player
+    m_uid_pool_count = 0;
+    m_uid_pool_first = 0;
+    m_uid_objects.assign(1, NULL);
+    m_use_activity_regions = 0;
+    m_activity_order_first = 0;
+    m_activity_order_last = 0;
+    m_type_lists_locked = 0;
+    m_type_lists_dirty = 0;
+    m_type_lists_valid = 0;
     m_z_pos_data.assign(zpos_items, 0.0f);
     m_z_pos_data_editor.assign(zpos_items,0.0f);
 }
@@ -50,6 +79,11 @@ void cSprite_Manager::Add(cSprite* sprite)
         return;
     }
 
+    // deleted without its data in this frame and still in the array
+    if (sprite->m_manager_entry.m_manager == this && sprite->m_manager_entry.m_deleted) {
+        Compact();
+    }
+
     // Ensure sprites of the same layer get slightly different Z
     // coordinates. See method docs in sprite_manager.hpp for more
     //information.
@@ -75,21 +109,43 @@ void cSprite_Manager::Add(cSprite* sprite)
 //#endif
 
         // Mark the sprite’s UID as taken
-        m_uid_pool.erase(sprite->m_uid);
+        Take_UID(sprite->m_uid);
     }
 
     // Check if an destroyed object can be replaced
-    for (cSprite_List::iterator itr = objects.begin(); itr != objects.end(); ++itr) {
+    while (!m_destroyed_slots.empty()) {
+        const size_t array_num = m_destroyed_slots.back();
+        m_destroyed_slots.pop_back();
+
+        // the slot may have been reused or removed since
+        if (array_num >= objects.size()) {
+            continue;
+        }
+
         // get object pointer
-        cSprite* obj = (*itr);
+        cSprite* obj = objects[array_num];
 
         // if destroy is set
-        if (obj->m_auto_destroy) {
+        if (obj->m_auto_destroy && !obj->m_manager_entry.m_deleted) {
             // set new object
-            *itr = sprite;
+            objects[array_num] = sprite;
+            sprite->m_manager_entry.m_manager = this;
+            sprite->m_manager_entry.m_index = array_num;
+            sprite->m_manager_entry.m_deleted = 0;
+            obj->m_manager_entry.m_manager = NULL;
+            m_spatial_hash.Remove(obj);
+            m_static_collision.Remove(obj);
+            m_spatial_hash.Add(sprite);
+            m_activity_regions.Remove(obj);
+            Type_List_Remove(obj);
+            sprite->m_activity_entry.m_order = obj->m_activity_entry.m_order;
+            m_activity_regions.Add(sprite);
+            Type_List_Add(sprite);
+            Unindex_UID(obj);
+            Index_UID(sprite);
 
             // Release old sprite’s UID by putting it back into the UID pool
-            m_uid_pool.insert(obj->m_uid);
+            Release_UID(obj->m_uid);
 
             // delete old
             delete obj;
@@ -99,6 +155,89 @@ void cSprite_Manager::Add(cSprite* sprite)
     }
 
     cObject_Manager<cSprite>::Add(sprite);
+    Index_UID(sprite);
+    m_spatial_hash.Add(sprite);
+    sprite->m_activity_entry.m_order = ++m_activity_order_last;
+    m_activity_regions.Add(sprite);
+    Type_List_Add(sprite);
+
+    // already destroyed
+    if (sprite->m_auto_destroy) {
+        m_destroyed_slots.push_back(sprite->m_manager_entry.m_index);
+    }
+}
+
+bool cSprite_Manager::Delete(size_t array_num, bool delete_data /* = 1 */)
+{
+    if (array_num >= objects.size()) {
+        return 0;
+    }
+
+    return Delete(objects[array_num], delete_data);
+}
+
+bool cSprite_Manager::Delete(cSprite* sprite, bool delete_data /* = 1 */)
+{
+    // empty object
+    if (!sprite) {
+        return 0;
+    }
+
+    m_spatial_hash.Remove(sprite);
+    m_static_collision.Remove(sprite);
+    m_activity_regions.Remove(sprite);
+    Type_List_Remove(sprite);
+    Unindex_UID(sprite);
+
+    // stays in the array until Compact
+    const bool keep_in_array = sprite->m_manager_entry.m_manager == this;
+
+    if (!cObject_Manager<cSprite>::Delete(sprite, delete_data)) {
+        return 0;
+    }
+
+    // skipped like destroyed objects until removed
+    // if the caller uses the object again the loops check m_deleted instead
+    if (keep_in_array && delete_data) {
+        sprite->m_auto_destroy = 1;
+        sprite->m_active = 0;
+        sprite->m_valid_draw = 0;
+        sprite->m_valid_update = 0;
+    }
+
+    return 1;
+}
+
+void cSprite_Manager::Compact(void)
+{
+    const size_t old_size = objects.size();
+
+    cObject_Manager<cSprite>::Compact();
+    Type_Lists_Compact();
+
+    // nothing removed
+    if (objects.size() == old_size) {
+        return;
+    }
+
+    // the array positions changed
+    m_destroyed_slots.clear();
+
+    for (size_t i = 0; i < objects.size(); i++) {
+        if (objects[i]->m_auto_destroy) {
+            m_destroyed_slots.push_back(i);
+        }
+    }
+}
+
+void cSprite_Manager::Add_Destroyed(cSprite* sprite)
+{
+    // not in this manager
+    if (sprite->m_manager_entry.m_manager != this || sprite->m_manager_entry.m_deleted) {
+        return;
+    }
+
+    m_destroyed_slots.push_back(sprite->m_manager_entry.m_index);
 }
 
 cSprite* cSprite_Manager::Copy(unsigned int identifier)
@@ -182,6 +321,10 @@ void cSprite_Manager::Move_To_Front(cSprite* sprite)
     objects.erase(itr);
     objects.front() = sprite;
     objects.insert(objects.begin() + 1, first);
+    Update_Entries();
+    Type_List_Remove(sprite);
+    sprite->m_activity_entry.m_order = --m_activity_order_first;
+    Type_List_Add(sprite);
 
     // make it the first z position
     sprite->m_pos_z = Get_First(sprite->m_type)->m_pos_z - cSprite::m_pos_z_delta;
@@ -210,9 +353,15 @@ void cSprite_Manager::Move_To_Back(cSprite* sprite)
         return;
     }
 
+    const size_t array_num = itr - objects.begin();
+
     objects.erase(itr);
     objects.back() = sprite;
     objects.insert(objects.end() - 1, last);
+    Update_Entries(array_num);
+    Type_List_Remove(sprite);
+    sprite->m_activity_entry.m_order = ++m_activity_order_last;
+    Type_List_Add(sprite);
 
     // make it the last z position
     Ensure_Different_Z(sprite);
@@ -237,6 +386,12 @@ void cSprite_Manager::Delete_All(bool delayed /* = 0 */)
             cSprite* obj = (*itr);
 
             if (obj->m_disallow_managed_delete) {
+                m_spatial_hash.Remove(obj);
+                m_static_collision.Remove(obj);
+                m_activity_regions.Remove(obj);
+                Type_List_Remove(obj);
+                Unindex_UID(obj);
+                obj->m_manager_entry.m_manager = NULL;
                 itr = objects.erase(itr);
             }
             // increment
@@ -246,10 +401,24 @@ void cSprite_Manager::Delete_All(bool delayed /* = 0 */)
         }
 
         cObject_Manager<cSprite>::Delete_All();
+        m_spatial_hash.Clear();
+        m_static_collision.Clear();
+        m_activity_regions.Clear();
+        m_type_objects.clear();
+        m_type_pending.clear();
+        m_type_lists_dirty = 0;
+        m_type_lists_valid = 0;
+        m_destroyed_slots.clear();
+        std::fill(m_uid_objects.begin(), m_uid_objects.end(), static_cast<cSprite*>(NULL));
+        m_uid_shared.clear();
+        m_activity_order_first = 0;
+        m_activity_order_last = 0;
     }
 
     // Empty the UID pool, we have no sprites anymore
-    m_uid_pool.clear();
+    std::fill(m_uid_pool.begin(), m_uid_pool.end(), 0);
+    m_uid_pool_count = 0;
+    m_uid_pool_first = m_uid_pool.size();
 
     // clear z position data
     std::fill(m_z_pos_data.begin(), m_z_pos_data.end(), 0.0f);
@@ -321,11 +490,10 @@ cSprite* cSprite_Manager::Get_from_Position(int start_pos_x, int start_pos_y, co
 
 cSprite* cSprite_Manager::Get_by_UID(int uid) const
 {
-    for (cSprite_List::const_iterator itr = objects.begin(); itr != objects.end(); ++itr) {
-        if ((*itr)->m_uid == uid)
-            return *itr;
-    }
-    return NULL;
+    if (uid <= 0 || static_cast<size_t>(uid) >= m_uid_objects.size())
+        return NULL;
+
+    return m_uid_objects[uid];
 }
 
 void cSprite_Manager::Get_Objects_sorted(cSprite_List& new_objects, bool editor_sort /* = 0 */, bool with_player /* = 0 */) const
@@ -349,8 +517,69 @@ void cSprite_Manager::Get_Objects_sorted(cSprite_List& new_objects, bool editor_
 
 void cSprite_Manager::Get_Colliding_Objects(cSprite_List& col_objects, const GL_rect& rect, bool with_player /* = 0 */, const cSprite* exclude_sprite /* = NULL */) const
 {
+    const size_t start = col_objects.size();
+
+    // get the immobile objects and the objects from the touched cells
+    m_static_collision.Query(rect, col_objects);
+    m_spatial_hash.Query(rect, col_objects);
+
     // Check objects
-    for (cSprite_List::const_iterator itr = objects.begin(); itr != objects.end(); ++itr) {
+    cSprite_List::iterator valid_itr = col_objects.begin() + start;
+
+    for (cSprite_List::iterator itr = valid_itr; itr != col_objects.end(); ++itr) {
+        // get object pointer
+        cSprite* obj = (*itr);
+
+        // if destroyed object
+        if (obj == exclude_sprite || obj->m_auto_destroy) {
+            continue;
+        }
+
+        // if rects don't touch
+        if (!rect.Intersects(obj->m_col_rect)) {
+            continue;
+        }
+
+        *valid_itr = obj;
+        ++valid_itr;
+    }
+
+    col_objects.erase(valid_itr, col_objects.end());
+
+    if (with_player && pActive_Player != exclude_sprite) {
+        if (rect.Intersects(pActive_Player->m_col_rect)) {
+            col_objects.push_back(pActive_Player);
+        }
+    }
+}
+
+void cSprite_Manager::Get_Colliding_Objects(cSprite_List& col_objects, const GL_rect& rect, cCollision_Cache& cache, bool with_player /* = 0 */, const cSprite* exclude_sprite /* = NULL */) const
+{
+    // check if the cached objects can be used
+    bool valid = cache.m_sprite_manager == this &&
+                 cache.m_static_generation == m_static_collision.Get_Generation() &&
+                 m_spatial_hash.Is_Unchanged_Since(cache.m_hash_generation, exclude_sprite);
+
+    if (valid) {
+        valid = rect.m_x >= cache.m_rect.m_x && rect.m_y >= cache.m_rect.m_y &&
+                rect.m_x + rect.m_w <= cache.m_rect.m_x + cache.m_rect.m_w &&
+                rect.m_y + rect.m_h <= cache.m_rect.m_y + cache.m_rect.m_h;
+    }
+
+    // fill the cache with the objects around the rect
+    if (!valid) {
+        cache.m_sprite_manager = this;
+        cache.m_rect = GL_rect(rect.m_x - m_collision_cache_border, rect.m_y - m_collision_cache_border, rect.m_w + m_collision_cache_border * 2.0f, rect.m_h + m_collision_cache_border * 2.0f);
+        cache.m_hash_generation = m_spatial_hash.Get_Generation();
+        cache.m_static_generation = m_static_collision.Get_Generation();
+        cache.m_objects.clear();
+
+        m_static_collision.Query(cache.m_rect, cache.m_objects);
+        m_spatial_hash.Query(cache.m_rect, cache.m_objects);
+    }
+
+    // Check objects
+    for (cSprite_List::const_iterator itr = cache.m_objects.begin(); itr != cache.m_objects.end(); ++itr) {
         // get object pointer
         cSprite* obj = (*itr);
 
@@ -376,6 +605,9 @@ void cSprite_Manager::Get_Colliding_Objects(cSprite_List& col_objects, const GL_
 
 void cSprite_Manager::Get_Colliding_Objects(cSprite_List& col_objects, const GL_Circle& circle, bool with_player /* = 0 */, const cSprite* exclude_sprite /* = NULL */) const
 {
+    /* GL_Circle::Intersects only approximates the rect radius
+     * so a bounding rect query could miss objects
+    */
     // Check objects
     for (cSprite_List::const_iterator itr = objects.begin(); itr != objects.end(); ++itr) {
         // get object pointer
@@ -401,11 +633,408 @@ void cSprite_Manager::Get_Colliding_Objects(cSprite_List& col_objects, const GL_
     }
 }
 
+void cSprite_Manager::Update_Items_Valid_Draw(void)
+{
+    Type_Lists_Update();
+
+    if (!m_type_dispatch) {
+        for (cSprite_List::iterator itr = objects.begin(); itr != objects.end(); ++itr) {
+            // deleted in this frame
+            if (!(*itr)->m_manager_entry.m_deleted) {
+                (*itr)->Update_Valid_Draw();
+            }
+        }
+
+        return;
+    }
+
+    for (vector<cSprite_List>::iterator list_itr = m_type_objects.begin(); list_itr != m_type_objects.end(); ++list_itr) {
+        for (cSprite_List::iterator itr = list_itr->begin(); itr != list_itr->end(); ++itr) {
+            // removed
+            if (*itr) {
+                (*itr)->Update_Valid_Draw();
+            }
+        }
+    }
+}
+
+void cSprite_Manager::Update_Items(void)
+{
+    // invalidates the thinking of the last frame
+    m_think_frame++;
+    Type_Lists_Update();
+
+    if (m_use_activity_regions) {
+        m_activity_regions.Update_Active(pActive_Camera->m_x + (game_res_w * 0.5f), pActive_Camera->m_y + (game_res_h * 0.5f), m_type_dispatch);
+
+        const cSprite_List& active_objects = m_activity_regions.Get_Active();
+
+        Think_List_Add(active_objects);
+        Think_Items();
+
+        // removed objects are set to NULL
+        for (size_t i = 0; i < active_objects.size(); i++) {
+            if (active_objects[i]) {
+                active_objects[i]->Update();
+            }
+        }
+    }
+    else if (m_type_dispatch) {
+        for (vector<cSprite_List>::const_iterator itr = m_type_objects.begin(); itr != m_type_objects.end(); ++itr) {
+            Think_List_Add(*itr);
+        }
+        Think_Items();
+
+        // by index as updates can add objects
+        // removed objects are set to NULL and inserted objects wait in the pending list
+        m_type_lists_locked = 1;
+
+        for (size_t type = 0; type < m_type_objects.size(); type++) {
+            for (size_t i = 0; i < m_type_objects[type].size(); i++) {
+                cSprite* obj = m_type_objects[type][i];
+
+                if (obj) {
+                    obj->Update();
+                }
+            }
+        }
+
+        m_type_lists_locked = 0;
+        Type_Lists_Compact();
+    }
+    else {
+        Think_List_Add(objects);
+        Think_Items();
+
+        for (cSprite_List::iterator itr = objects.begin(); itr != objects.end(); ++itr) {
+            // deleted in this frame
+            if (!(*itr)->m_manager_entry.m_deleted) {
+                (*itr)->Update();
+            }
+        }
+    }
+}
+
+void cSprite_Manager::Update_Items_Late(void)
+{
+    Type_Lists_Update();
+
+    if (m_use_activity_regions) {
+        const cSprite_List& active_objects = m_activity_regions.Get_Active();
+
+        for (size_t i = 0; i < active_objects.size(); i++) {
+            if (active_objects[i]) {
+                active_objects[i]->Update_Late();
+            }
+        }
+    }
+    else if (m_type_dispatch) {
+        m_type_lists_locked = 1;
+
+        for (size_t type = 0; type < m_type_objects.size(); type++) {
+            for (size_t i = 0; i < m_type_objects[type].size(); i++) {
+                cSprite* obj = m_type_objects[type][i];
+
+                if (obj) {
+                    obj->Update_Late();
+                }
+            }
+        }
+
+        m_type_lists_locked = 0;
+        Type_Lists_Compact();
+    }
+    else {
+        for (cSprite_List::iterator itr = objects.begin(); itr != objects.end(); ++itr) {
+            // deleted in this frame
+            if (!(*itr)->m_manager_entry.m_deleted) {
+                (*itr)->Update_Late();
+            }
+        }
+    }
+}
+
+void cSprite_Manager::Draw_Items(void)
+{
+    Type_Lists_Update();
+
+    if (!m_type_dispatch) {
+        for (cSprite_List::iterator itr = objects.begin(); itr != objects.end(); ++itr) {
+            // deleted in this frame
+            if (!(*itr)->m_manager_entry.m_deleted) {
+                (*itr)->Draw();
+            }
+        }
+
+        return;
+    }
+
+    for (vector<cSprite_List>::iterator list_itr = m_type_objects.begin(); list_itr != m_type_objects.end(); ++list_itr) {
+        for (cSprite_List::iterator itr = list_itr->begin(); itr != list_itr->end(); ++itr) {
+            // removed
+            if (*itr) {
+                (*itr)->Draw();
+            }
+        }
+    }
+}
+
+// think of a range of the think list
+struct think_job {
+    const cSprite_List* m_objects;
+    uint32_t m_frame;
+
+    void operator()(size_t begin, size_t end) const
+    {
+        for (size_t i = begin; i < end; i++) {
+            cSprite* obj = (*m_objects)[i];
+
+            obj->Think();
+            obj->m_think_frame = m_frame;
+        }
+    }
+};
+
+void cSprite_Manager::Think_List_Add(const cSprite_List& list)
+{
+    if (!m_parallel_think) {
+        return;
+    }
+
+    for (cSprite_List::const_iterator itr = list.begin(); itr != list.end(); ++itr) {
+        cSprite* obj = (*itr);
+
+        // removed objects are NULL in the active list
+        if (obj && obj->m_parallel_think) {
+            m_think_objects.push_back(obj);
+        }
+    }
+}
+
+void cSprite_Manager::Think_Items(void)
+{
+    if (m_think_objects.empty()) {
+        return;
+    }
+
+    think_job think;
+    think.m_objects = &m_think_objects;
+    think.m_frame = m_think_frame;
+
+    if (pJob_Pool) {
+        pJob_Pool->Run(m_think_objects.size(), think_job_grain, think);
+    }
+    else {
+        think(0, m_think_objects.size());
+    }
+
+    m_think_objects.clear();
+}
+
+void cSprite_Manager::Save_Step_Positions(void)
+{
+    for (cSprite_List::iterator itr = objects.begin(); itr != objects.end(); ++itr) {
+        (*itr)->Save_Step_Pos();
+    }
+}
+
+void cSprite_Manager::Interpolate_Position(cSprite* obj, float alpha)
+{
+    // added in the last step or not moving
+    if (!obj->m_step_pos_valid || (obj->m_pos_x == obj->m_step_pos_x && obj->m_pos_y == obj->m_step_pos_y)) {
+        return;
+    }
+
+    float x = obj->m_pos_x;
+    float y = obj->m_pos_y;
+
+    if (!Interpolate_Step_Pos(x, y, obj->m_step_pos_x, obj->m_step_pos_y, alpha)) {
+        return;
+    }
+
+    Interpolated_Pos pos;
+    pos.m_obj = obj;
+    pos.m_pos_x = obj->m_pos_x;
+    pos.m_pos_y = obj->m_pos_y;
+    m_interpolated.push_back(pos);
+
+    // only the drawing position as the rects are not needed for drawing
+    obj->m_pos_x = x;
+    obj->m_pos_y = y;
+}
+
+void cSprite_Manager::Interpolate_Positions(float alpha)
+{
+    for (cSprite_List::iterator itr = objects.begin(); itr != objects.end(); ++itr) {
+        Interpolate_Position(*itr, alpha);
+    }
+}
+
+void cSprite_Manager::Restore_Positions(void)
+{
+    for (vector<Interpolated_Pos>::iterator itr = m_interpolated.begin(); itr != m_interpolated.end(); ++itr) {
+        itr->m_obj->m_pos_x = itr->m_pos_x;
+        itr->m_obj->m_pos_y = itr->m_pos_y;
+    }
+
+    m_interpolated.clear();
+}
+
+void cSprite_Manager::Type_List_Add(cSprite* sprite)
+{
+    // built from the array when needed
+    if (!m_type_lists_valid) {
+        return;
+    }
+
+    const int type = sprite->m_type > 0 ? sprite->m_type : 0;
+
+    if (static_cast<size_t>(type) >= m_type_objects.size()) {
+        m_type_objects.resize(type + 1);
+    }
+
+    cActivity_Entry& entry = sprite->m_activity_entry;
+
+    // the type may change later
+    entry.m_type_list = type;
+    entry.m_type_pending = 0;
+
+    cSprite_List* list = &m_type_objects[type];
+
+    // mostly added at the end
+    if (list->empty() || entry.m_order >= m_activity_order_last || (list->back() && list->back()->m_activity_entry.m_order < entry.m_order)) {
+        entry.m_type_index = list->size();
+        list->push_back(sprite);
+        return;
+    }
+
+    // inserting would move the objects iterated by index
+    if (m_type_lists_locked) {
+        entry.m_type_pending = 1;
+        entry.m_type_index = m_type_pending.size();
+        m_type_pending.push_back(sprite);
+        m_type_lists_dirty = 1;
+        return;
+    }
+
+    // the search needs the removed positions gone
+    if (m_type_lists_dirty) {
+        Type_Lists_Compact();
+        list = &m_type_objects[type];
+    }
+
+    cSprite_List::iterator itr = list->insert(std::upper_bound(list->begin(), list->end(), sprite, activity_order_less()), sprite);
+
+    // the following objects moved
+    for (size_t i = itr - list->begin(); i < list->size(); i++) {
+        (*list)[i]->m_activity_entry.m_type_index = i;
+    }
+}
+
+void cSprite_Manager::Type_List_Remove(cSprite* sprite)
+{
+    if (!m_type_lists_valid) {
+        return;
+    }
+
+    cActivity_Entry& entry = sprite->m_activity_entry;
+    const int type = entry.m_type_list;
+
+    if (type < 0 || static_cast<size_t>(type) >= m_type_objects.size()) {
+        return;
+    }
+
+    cSprite_List& list = entry.m_type_pending ? m_type_pending : m_type_objects[type];
+
+    // not from this manager
+    if (entry.m_type_index >= list.size() || list[entry.m_type_index] != sprite) {
+        return;
+    }
+
+    // keep the positions of the following objects
+    list[entry.m_type_index] = NULL;
+    entry.m_type_list = -1;
+    entry.m_type_pending = 0;
+    m_type_lists_dirty = 1;
+}
+
+void cSprite_Manager::Type_Lists_Compact(void)
+{
+    if (!m_type_lists_dirty || m_type_lists_locked) {
+        return;
+    }
+
+    m_type_lists_dirty = 0;
+
+    for (vector<cSprite_List>::iterator list_itr = m_type_objects.begin(); list_itr != m_type_objects.end(); ++list_itr) {
+        cSprite_List& list = *list_itr;
+        size_t count = 0;
+
+        for (size_t i = 0; i < list.size(); i++) {
+            cSprite* obj = list[i];
+
+            // removed
+            if (!obj) {
+                continue;
+            }
+
+            obj->m_activity_entry.m_type_index = count;
+            list[count] = obj;
+            count++;
+        }
+
+        list.resize(count);
+    }
+
+    // insert the objects added while iterating
+    cSprite_List pending;
+    pending.swap(m_type_pending);
+
+    for (cSprite_List::iterator itr = pending.begin(); itr != pending.end(); ++itr) {
+        if (*itr) {
+            Type_List_Add(*itr);
+        }
+    }
+}
+
+void cSprite_Manager::Type_Lists_Update(void)
+{
+    if (m_type_dispatch == m_type_lists_valid) {
+        return;
+    }
+
+    m_type_objects.clear();
+    m_type_pending.clear();
+    m_type_lists_dirty = 0;
+    m_type_lists_valid = m_type_dispatch;
+
+    if (!m_type_lists_valid) {
+        return;
+    }
+
+    // the array is in activity order
+    for (cSprite_List::iterator itr = objects.begin(); itr != objects.end(); ++itr) {
+        cSprite* obj = (*itr);
+
+        // deleted in this frame
+        if (!obj->m_manager_entry.m_deleted) {
+            Type_List_Add(obj);
+        }
+    }
+}
+
 void cSprite_Manager::Handle_Collision_Items(void)
 {
+    Update_Spatial_Hash();
+
     for (cSprite_List::iterator itr = objects.begin(); itr != objects.end(); ++itr) {
         cSprite* obj = (*itr);
 
+        // deleted in this frame
+        if (obj->m_manager_entry.m_deleted) {
+            continue;
+        }
+
         // invalid
         if (obj->m_auto_destroy) {
             if (obj->m_collisions.size()) {
@@ -423,6 +1052,54 @@ void cSprite_Manager::Handle_Collision_Items(void)
     }
 }
 
+void cSprite_Manager::Update_Spatial_Hash(void)
+{
+    for (cSprite_List::iterator itr = objects.begin(); itr != objects.end(); ++itr) {
+        cSprite* obj = (*itr);
+
+        if (obj->m_static_collision_index >= 0) {
+            Update_Static_Collision(obj);
+        }
+        else {
+            m_spatial_hash.Update(obj);
+        }
+    }
+}
+
+void cSprite_Manager::Build_Static_Collision(void)
+{
+    // move all objects back from the previous build
+    for (cSprite_List::iterator itr = objects.begin(); itr != objects.end(); ++itr) {
+        cSprite* obj = (*itr);
+
+        if (obj->m_static_collision_index >= 0) {
+            m_static_collision.Remove(obj);
+            m_spatial_hash.Add(obj);
+        }
+    }
+
+    m_static_collision.Build(objects);
+
+    // the static objects are only in the static collision list
+    for (cSprite_List::iterator itr = objects.begin(); itr != objects.end(); ++itr) {
+        cSprite* obj = (*itr);
+
+        if (obj->m_static_collision_index >= 0) {
+            m_spatial_hash.Remove(obj);
+        }
+    }
+}
+
+void cSprite_Manager::Update_Static_Collision(cSprite* sprite)
+{
+    if (!m_static_collision.Has_Changed(sprite)) {
+        return;
+    }
+
+    m_static_collision.Remove(sprite);
+    m_spatial_hash.Add(sprite);
+}
+
 unsigned int cSprite_Manager::Get_Size_Array(const ArrayType sprite_array)
 {
     unsigned int count = 0;
@@ -436,13 +1113,12 @@ unsigned int cSprite_Manager::Get_Size_Array(const ArrayType sprite_array)
     return count;
 }
 
-/* The member m_uid_pool contains a list of all those UIDs that
- * are *not* currently in use, sorted from the smallest to
- * the greatest (not necessarily without gaps, as destroyed
- * sprites give their UID back into the pool). This allows
+/* The member m_uid_pool contains a set bit for all those UIDs that
+ * are *not* currently in use (not necessarily without gaps, as
+ * destroyed sprites give their UID back into the pool). This allows
  * use to quickly find the next free UID without much searching
- * by just picking the very first element from m_uid_pool,
- * which, as said, is always sorted and stays so.
+ * by just picking the lowest set bit, starting at the first word
+ * which may have one.
  *
  * However, at the level start this would mean that m_uid_pool
  * must contain infinitely many numbers reaching from 1 to ∞. Well,
@@ -455,13 +1131,21 @@ unsigned int cSprite_Manager::Get_Size_Array(const ArrayType sprite_array)
 int cSprite_Manager::Generate_UID()
 {
     // Allocate 10 new UIDs if the pool is empty
-    if (m_uid_pool.empty())
+    if (!m_uid_pool_count)
         Allocate_UIDs(m_max_uid_mark + 10);
 
     // Pool is not empty, return the first available UID.
-    std::set<int>::const_iterator iter = m_uid_pool.begin();
-    int id = *iter;
-    m_uid_pool.erase(iter);
+    while (!m_uid_pool[m_uid_pool_first])
+        m_uid_pool_first++;
+
+    const uint64_t word = m_uid_pool[m_uid_pool_first];
+    int bit = 0;
+
+    while (!(word & (static_cast<uint64_t>(1) << bit)))
+        bit++;
+
+    int id = static_cast<int>(m_uid_pool_first * 64) + bit;
+    Take_UID(id);
     return id;
 }
 
@@ -479,8 +1163,14 @@ void cSprite_Manager::Allocate_UIDs(long new_max_uid_mark)
         throw(std::range_error("Too many sprites, unable to generate further UIDs!"));
 
     // Actually allocate the numbers for the UID pool
+    m_uid_pool.resize((static_cast<size_t>(new_max_uid_mark) + 63) / 64, 0);
+    m_uid_objects.resize(static_cast<size_t>(new_max_uid_mark), NULL);
+
     for (int i = m_max_uid_mark; i < static_cast<int>(new_max_uid_mark); i++) // new_max_uid_mark is guaranteed to be < INT_MAX
-        m_uid_pool.insert(i);
+        m_uid_pool[i / 64] |= static_cast<uint64_t>(1) << (i % 64);
+
+    m_uid_pool_count += static_cast<size_t>(new_max_uid_mark - m_max_uid_mark);
+    m_uid_pool_first = std::min(m_uid_pool_first, static_cast<size_t>(m_max_uid_mark / 64));
 
     // Remember the new maximum. Note that by checking INT_MAX, we have
     // ensured the values fits into an int.
@@ -498,12 +1188,94 @@ bool cSprite_Manager::Is_UID_In_Use(int uid)
     if (uid >= m_max_uid_mark)
         return false;
 
-    if (m_uid_pool.find(uid) == m_uid_pool.end())
+    // Negative UIDs are never in the pool
+    if (uid < 0)
+        return true;
+
+    if (!(m_uid_pool[uid / 64] & (static_cast<uint64_t>(1) << (uid % 64))))
         return true;
 
     return false;
 }
 
+void cSprite_Manager::Reserve_UID(int uid)
+{
+    if (uid <= 0)
+        return;
+
+    if (uid >= m_max_uid_mark)
+        Allocate_UIDs(uid + 1);
+
+    Take_UID(uid);
+}
+
+void cSprite_Manager::Take_UID(int uid)
+{
+    if (uid <= 0 || uid >= m_max_uid_mark)
+        return;
+
+    const uint64_t bit = static_cast<uint64_t>(1) << (uid % 64);
+
+    if (m_uid_pool[uid / 64] & bit) {
+        m_uid_pool[uid / 64] &= ~bit;
+        m_uid_pool_count--;
+    }
+}
+
+void cSprite_Manager::Release_UID(int uid)
+{
+    if (uid <= 0 || uid >= m_max_uid_mark)
+        return;
+
+    const uint64_t bit = static_cast<uint64_t>(1) << (uid % 64);
+
+    if (!(m_uid_pool[uid / 64] & bit)) {
+        m_uid_pool[uid / 64] |= bit;
+        m_uid_pool_count++;
+        m_uid_pool_first = std::min(m_uid_pool_first, static_cast<size_t>(uid / 64));
+    }
+}
+
+void cSprite_Manager::Index_UID(cSprite* sprite)
+{
+    // Add() allocated the UID so it is below m_max_uid_mark
+    if (sprite->m_uid <= 0 || static_cast<size_t>(sprite->m_uid) >= m_uid_objects.size())
+        return;
+
+    // On UID collisions keep the first object like the old array search
+    if (!m_uid_objects[sprite->m_uid])
+        m_uid_objects[sprite->m_uid] = sprite;
+    else if (m_uid_objects[sprite->m_uid] != sprite)
+        m_uid_shared.insert(sprite->m_uid);
+}
+
+void cSprite_Manager::Unindex_UID(cSprite* sprite)
+{
+    if (sprite->m_uid <= 0 || static_cast<size_t>(sprite->m_uid) >= m_uid_objects.size())
+        return;
+
+    if (m_uid_objects[sprite->m_uid] != sprite)
+        return;
+
+    m_uid_objects[sprite->m_uid] = NULL;
+
+    // only searched for UID collisions
+    if (!m_uid_shared.count(sprite->m_uid))
+        return;
+
+    for (cSprite_List::const_iterator itr = objects.begin(); itr != objects.end(); ++itr) {
+        cSprite* obj = (*itr);
+
+        if (obj != sprite && obj->m_uid == sprite->m_uid && !obj->m_manager_entry.m_deleted) {
+            m_uid_objects[sprite->m_uid] = obj;
+            return;
+        }
+    }
+
+    // the last object with this UID is gone
+    m_uid_shared.erase(sprite->m_uid);
+}
+
 /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
 
 } // namespace TSC
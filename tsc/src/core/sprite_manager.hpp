@@ -19,6 +19,9 @@
 
 #include "../core/global_game.hpp"
 #include "../core/obj_manager.hpp"
+#include "../core/spatial_hash.hpp"
+#include "../core/activity_regions.hpp"
+#include "../core/static_collision.hpp"
 #include "../objects/movingsprite.hpp"
 
 namespace TSC {
@@ -36,6 +39,23 @@ namespace TSC {
          */
         virtual void Add(cSprite* sprite);
 
+        // Delete the object from given array number
+        virtual bool Delete(size_t array_num, bool delete_data = 1);
+        /* Delete the given object
+         * it stays in the array until the next Compact
+         * without delete_data it must not be deleted by the caller before
+        */
+        virtual bool Delete(cSprite* sprite, bool delete_data = 1);
+
+        /* Remove the deleted objects from the array
+         * should be called once per frame
+        */
+        void Compact(void);
+        /* Remember the array position of the destroyed sprite
+         * it is replaced by the next added sprite
+        */
+        void Add_Destroyed(cSprite* sprite);
+
         // Return a sprite copy
         cSprite* Copy(unsigned int identifier);
 
@@ -77,41 +97,56 @@ namespace TSC {
         /* Get objects colliding with the given rectangle/circle
          * with_player : include player in check
          * exclude_sprite : exclude the given sprite from check
+         * the rectangle check only tests the static collision list and the spatial hash cells
+         * the order of the found objects is not the array order
         */
         void Get_Colliding_Objects(cSprite_List& col_objects, const GL_rect& rect, bool with_player = 0, const cSprite* exclude_sprite = NULL) const;
         void Get_Colliding_Objects(cSprite_List& col_objects, const GL_Circle& circle, bool with_player = 0, const cSprite* exclude_sprite = NULL) const;
+        /* Get objects colliding with the given rectangle
+         * uses the objects from the cache if still valid
+         * else the cache is filled with the objects around the rectangle
+         * exclude_sprite should be the sprite owning the cache
+        */
+        void Get_Colliding_Objects(cSprite_List& col_objects, const GL_rect& rect, cCollision_Cache& cache, bool with_player = 0, const cSprite* exclude_sprite = NULL) const;
 
         // Update items drawing validation
-        inline void Update_Items_Valid_Draw(void)
-        {
-            for (cSprite_List::iterator itr = objects.begin(); itr != objects.end(); ++itr) {
-                (*itr)->Update_Valid_Draw();
-            }
-        }
-        // Update items
-        inline void Update_Items(void)
-        {
-            for (cSprite_List::iterator itr = objects.begin(); itr != objects.end(); ++itr) {
-                (*itr)->Update();
-            }
-        }
-        // Update_Late items
-        inline void Update_Items_Late(void)
-        {
-            for (cSprite_List::iterator itr = objects.begin(); itr != objects.end(); ++itr) {
-                (*itr)->Update_Late();
-            }
-        }
+        void Update_Items_Valid_Draw(void);
+        /* Update items
+         * if activity regions are used only the items near the camera are updated
+        */
+        void Update_Items(void);
+        /* Update_Late items
+         * uses the same items as the last Update_Items
+        */
+        void Update_Items_Late(void);
         // Draw items
-        inline void Draw_Items(void)
-        {
-            for (cSprite_List::iterator itr = objects.begin(); itr != objects.end(); ++itr) {
-                (*itr)->Draw();
-            }
-        }
+        void Draw_Items(void);
+
+        // Remember the positions of all items at the start of a fixed simulation step
+        void Save_Step_Positions(void);
+        /* Move the given object between its step start position and its current position
+         * for drawing and remember it for Restore_Positions
+        */
+        void Interpolate_Position(cSprite* obj, float alpha);
+        // Interpolate the positions of all items
+        void Interpolate_Positions(float alpha);
+        // Restore the positions of the interpolated objects
+        void Restore_Positions(void);
 
         // Create Collision data and Handle the collisions
         void Handle_Collision_Items(void);
+        /* Update the spatial hash cells of all objects
+         * needed for collision rect changes not done with Update_Position_Rect
+        */
+        void Update_Spatial_Hash(void);
+        /* Move the immobile massive and halfmassive objects into the static collision list
+         * should be called once after all objects are loaded
+        */
+        void Build_Static_Collision(void);
+        /* Move the object into the spatial hash if its collision rect
+         * differs from the one in the static collision list
+        */
+        void Update_Static_Collision(cSprite* sprite);
 
 
         /* Return the current size
@@ -135,18 +170,51 @@ namespace TSC {
         // available uid is `new_max_uid_mark - 1'. This method does nothing
         // if `new_max_uid_mark' is smaller than the current max mark.
         void Allocate_UIDs(long new_max_uid_mark);
+        // Mark the UID as used by an object which is added later
+        void Reserve_UID(int uid);
+
+        // collision broadphase of all objects
+        cSpatial_Hash m_spatial_hash;
+        // collision list of the immobile objects
+        cStatic_Collision m_static_collision;
+        // update scheduling of all objects
+        cActivity_Regions m_activity_regions;
+        // if set only the objects in active regions are updated
+        bool m_use_activity_regions;
+        /* if set the items are updated and drawn grouped by their type
+         * objects of the same type keep the array order but the order
+         * between types changes, so it is only used for benchmarking
+         * the type lists are only kept while it is set
+        */
+        static bool m_type_dispatch;
+        /* if set the Think of the objects with m_parallel_think is called
+         * on the job pool before updating them
+        */
+        static bool m_parallel_think;
+        // increased by every Update_Items
+        static uint32_t m_think_frame;
+        // border added around cached collision query rects
+        static const float m_collision_cache_border;
 
         typedef vector<float> ZposList;
         // biggest type z position
         ZposList m_z_pos_data;
         // biggest editor type z position
         ZposList m_z_pos_data_editor;
-        // This set holds the not-yet-used UIDs so we can easily
-        // find the next free one.
-        std::set<int> m_uid_pool;
+        // This bitmap holds a set bit for every not-yet-used UID
+        // below m_max_uid_mark so we can easily find the next free one.
+        vector<uint64_t> m_uid_pool;
+        // Number of set bits in the UID pool
+        size_t m_uid_pool_count;
+        // Index of the first UID pool word which may have a set bit
+        size_t m_uid_pool_first;
         // The UID pool is filled as needed. This is always the first
         // non-yet allocated UID.
         int m_max_uid_mark;
+        // The object of every UID below m_max_uid_mark or NULL
+        cSprite_List m_uid_objects;
+        // UIDs given to more than one object, e.g. by old levels
+        std::set<int> m_uid_shared;
 
         // Z position sort
         struct zpos_sort {
@@ -181,6 +249,12 @@ namespace TSC {
             }
         };
 
+    protected:
+        virtual cObject_Manager_Entry* Get_Entry(cSprite* obj) const
+        {
+            return &obj->m_manager_entry;
+        }
+
     private:
         /* When multiple sprites of the same massivity are placed
          * on the same place (think two hills before one another,
@@ -193,6 +267,64 @@ namespace TSC {
          * are ensured to be placed in front of older ones.
          */
         void Ensure_Different_Z(cSprite* sprite);
+
+        // Remove the UID from the pool of available UIDs
+        void Take_UID(int uid);
+        // Put the UID back into the pool of available UIDs
+        void Release_UID(int uid);
+        // Remember the object for its UID if no other object has it
+        void Index_UID(cSprite* sprite);
+        /* Forget the object for its UID
+         * if the UID is shared the first other object in the array takes its place
+        */
+        void Unindex_UID(cSprite* sprite);
+
+        // Add the objects with m_parallel_think to the think list
+        void Think_List_Add(const cSprite_List& list);
+        // Call Think of the think list objects on the job pool and clear the list
+        void Think_Items(void);
+
+        // Add the sprite to the list of its type at its array order
+        void Type_List_Add(cSprite* sprite);
+        /* Remove the sprite from its type list
+         * its position is set to NULL until Type_Lists_Compact
+        */
+        void Type_List_Remove(cSprite* sprite);
+        // Remove the NULL positions from the type lists and insert the pending objects
+        void Type_Lists_Compact(void);
+        /* Build the type lists from the array if type dispatch was enabled
+         * or forget them if it was disabled
+        */
+        void Type_Lists_Update(void);
+
+        // activity order of the first and last object in the array
+        int64_t m_activity_order_first;
+        int64_t m_activity_order_last;
+        // objects of every type in array order, removed objects are NULL
+        vector<cSprite_List> m_type_objects;
+        /* objects added while the type lists are iterated which do not belong
+         * at the end of their list, removed objects are NULL
+        */
+        cSprite_List m_type_pending;
+        // if set the type lists are iterated by index and must not be reordered
+        bool m_type_lists_locked;
+        // if set the type lists have NULL positions or pending objects
+        bool m_type_lists_dirty;
+        // if set the type lists hold all objects
+        bool m_type_lists_valid;
+        // array positions of destroyed objects which can be replaced
+        vector<size_t> m_destroyed_slots;
+        // objects to call Think for in this frame
+        cSprite_List m_think_objects;
+
+        // position of an interpolated object
+        struct Interpolated_Pos {
+            cSprite* m_obj;
+            float m_pos_x;
+            float m_pos_y;
+        };
+        // objects moved by Interpolate_Position
+        vector<Interpolated_Pos> m_interpolated;
     };
 
     /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
@@ -0,0 +1,156 @@
+/***************************************************************************
+ * static_collision.cpp  -  Collision list of immobile level geometry
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "../core/static_collision.hpp"
+#include "../core/spatial_hash.hpp"
+#include "../objects/sprite.hpp"
+
+namespace TSC {
+
+/* *** *** *** *** *** *** *** cStatic_Collision *** *** *** *** *** *** *** *** *** *** */
+
+cStatic_Collision::cStatic_Collision(void)
+{
+    m_max_width = 0.0f;
+    m_removed_count = 0;
+    m_generation = cSpatial_Hash::Create_Generation();
+}
+
+cStatic_Collision::~cStatic_Collision(void)
+{
+    Clear();
+}
+
+bool cStatic_Collision::Is_Static(const cSprite* sprite)
+{
+    // only basic sprites never move by themselves
+    if (typeid(*sprite) != typeid(cSprite)) {
+        return 0;
+    }
+
+    if (sprite->m_massive_type != MASS_MASSIVE && sprite->m_massive_type != MASS_HALFMASSIVE) {
+        return 0;
+    }
+
+    if (sprite->m_auto_destroy) {
+        return 0;
+    }
+
+    return 1;
+}
+
+void cStatic_Collision::Build(const vector<cSprite*>& objects)
+{
+    Clear();
+
+    for (vector<cSprite*>::const_iterator itr = objects.begin(); itr != objects.end(); ++itr) {
+        cSprite* obj = (*itr);
+
+        if (!Is_Static(obj)) {
+            continue;
+        }
+
+        Entry entry;
+        entry.m_rect = obj->m_col_rect;
+        entry.m_sprite = obj;
+        m_entries.push_back(entry);
+
+        if (obj->m_col_rect.m_w > m_max_width) {
+            m_max_width = obj->m_col_rect.m_w;
+        }
+    }
+
+    std::sort(m_entries.begin(), m_entries.end(), entry_pos_sort());
+
+    for (size_t i = 0; i < m_entries.size(); i++) {
+        m_entries[i].m_sprite->m_static_collision_index = static_cast<int>(i);
+    }
+
+    m_generation = cSpatial_Hash::Create_Generation();
+}
+
+void cStatic_Collision::Remove(cSprite* sprite)
+{
+    const int index = sprite->m_static_collision_index;
+
+    if (index < 0 || static_cast<size_t>(index) >= m_entries.size() || m_entries[index].m_sprite != sprite) {
+        return;
+    }
+
+    // keep the indices of the other entries valid
+    m_entries[index].m_sprite = NULL;
+    sprite->m_static_collision_index = -1;
+    m_removed_count++;
+    m_generation = cSpatial_Hash::Create_Generation();
+
+    // all removed
+    if (m_removed_count == m_entries.size()) {
+        Clear();
+    }
+}
+
+bool cStatic_Collision::Has_Changed(const cSprite* sprite) const
+{
+    const int index = sprite->m_static_collision_index;
+
+    if (index < 0 || static_cast<size_t>(index) >= m_entries.size()) {
+        return 0;
+    }
+
+    const GL_rect& rect = m_entries[index].m_rect;
+
+    return rect.m_x != sprite->m_col_rect.m_x || rect.m_y != sprite->m_col_rect.m_y || rect.m_w != sprite->m_col_rect.m_w || rect.m_h != sprite->m_col_rect.m_h;
+}
+
+void cStatic_Collision::Clear(void)
+{
+    m_entries.clear();
+    m_max_width = 0.0f;
+    m_removed_count = 0;
+    m_generation = cSpatial_Hash::Create_Generation();
+}
+
+void cStatic_Collision::Query(const GL_rect& rect, vector<cSprite*>& result) const
+{
+    if (m_entries.empty()) {
+        return;
+    }
+
+    // entries starting left of this can not reach the rect
+    Entry start;
+    start.m_rect.m_x = rect.m_x - m_max_width;
+    start.m_sprite = NULL;
+
+    const float end_x = rect.m_x + rect.m_w;
+
+    for (EntryList::const_iterator itr = std::lower_bound(m_entries.begin(), m_entries.end(), start, entry_pos_sort()); itr != m_entries.end(); ++itr) {
+        const Entry& entry = (*itr);
+
+        // sorted so all following start right of the rect
+        if (entry.m_rect.m_x > end_x) {
+            break;
+        }
+
+        if (!entry.m_sprite || !rect.Intersects(entry.m_rect)) {
+            continue;
+        }
+
+        result.push_back(entry.m_sprite);
+    }
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
@@ -0,0 +1,96 @@
+/***************************************************************************
+ * static_collision.hpp  -  Collision list of immobile level geometry
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TSC_STATIC_COLLISION_HPP
+#define TSC_STATIC_COLLISION_HPP
+
+#include "../core/global_game.hpp"
+#include "../core/math/rect.hpp"
+
+namespace TSC {
+
+    /* *** *** *** *** *** *** *** cStatic_Collision *** *** *** *** *** *** *** *** *** *** */
+
+    /* Immobile massive and halfmassive sprites sorted by their collision rect x position
+     * It is built once after the level is loaded. Sprites are never re-sorted,
+     * a sprite whose collision rect changes has to be removed and handled as dynamic sprite.
+    */
+    class cStatic_Collision {
+    public:
+        cStatic_Collision(void);
+        ~cStatic_Collision(void);
+
+        // Return true if the sprite can be added as immobile geometry
+        static bool Is_Static(const cSprite* sprite);
+
+        /* Rebuild from the given sprites
+         * only the sprites valid for Is_Static() are added
+        */
+        void Build(const vector<cSprite*>& objects);
+        // Remove the sprite
+        void Remove(cSprite* sprite);
+        // Return true if the collision rect differs from the stored one
+        bool Has_Changed(const cSprite* sprite) const;
+        /* Forget all sprites
+         * the sprites are not accessed as they may already be deleted
+        */
+        void Clear(void);
+
+        /* Add all sprites with the stored collision rect touching the given rect to the list
+         * the exact intersection has to be checked by the caller
+        */
+        void Query(const GL_rect& rect, vector<cSprite*>& result) const;
+
+        // Return the number of sprites
+        inline size_t Get_Size(void) const
+        {
+            return m_entries.size() - m_removed_count;
+        }
+        // Return the generation of the last change
+        inline unsigned int Get_Generation(void) const
+        {
+            return m_generation;
+        }
+
+    private:
+        struct Entry {
+            GL_rect m_rect;
+            // NULL if removed
+            cSprite* m_sprite;
+        };
+
+        // Entry x position sort
+        struct entry_pos_sort {
+            bool operator()(const Entry& a, const Entry& b) const
+            {
+                return a.m_rect.m_x < b.m_rect.m_x;
+            }
+        };
+
+        typedef vector<Entry> EntryList;
+        EntryList m_entries;
+        // biggest collision rect width
+        float m_max_width;
+        // removed entries
+        size_t m_removed_count;
+        // changed with every build and removal
+        unsigned int m_generation;
+    };
+
+    /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
+
+#endif
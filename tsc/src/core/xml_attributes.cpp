@@ -19,20 +19,82 @@
 
 namespace TSC {
 
+/* *** *** *** *** *** *** *** XmlAttributes *** *** *** *** *** *** *** *** *** *** */
+
 void XmlAttributes::relocate_image(const std::string& filename_old, const std::string& filename_new, const std::string& attribute_name /* = "image" */)
 {
-    std::string current_value = (*this)[attribute_name];
+    std::string& current_value = (*this)[attribute_name];
     std::string filename_old_full = path_to_utf8(pResource_Manager->Get_Game_Pixmaps_Directory() / filename_old);
 
     if (current_value == filename_old || current_value == filename_old_full)
-        (*this)[attribute_name] = filename_new;
+        current_value = filename_new;
+}
+
+std::string& XmlAttributes::operator[](const std::string& key)
+{
+    iterator itr = find(key);
+
+    if (itr != m_values.end())
+        return itr->second;
+
+    m_values.push_back(value_type(key, std::string()));
+    return m_values.back().second;
+}
+
+XmlAttributes::iterator XmlAttributes::find(const std::string& key)
+{
+    for (iterator itr = m_values.begin(); itr != m_values.end(); ++itr) {
+        if (itr->first == key)
+            return itr;
+    }
+
+    return m_values.end();
+}
+
+XmlAttributes::const_iterator XmlAttributes::find(const std::string& key) const
+{
+    for (const_iterator itr = m_values.begin(); itr != m_values.end(); ++itr) {
+        if (itr->first == key)
+            return itr;
+    }
+
+    return m_values.end();
 }
 
-bool XmlAttributes::exists(const std::string& key)
+size_t XmlAttributes::erase(const std::string& key)
 {
-    if (count(key) > 0)
-        return true;
-    else
-        return false;
+    iterator itr = find(key);
+
+    if (itr == m_values.end())
+        return 0;
+
+    m_values.erase(itr);
+    return 1;
+}
+
+void XmlAttributes::rename(const std::string& old_key, const std::string& new_key)
+{
+    iterator itr = find(old_key);
+
+    if (itr == m_values.end() || old_key == new_key)
+        return;
+
+    // adding the new key may move the values
+    std::string value;
+    value.swap(itr->second);
+    m_values.erase(itr);
+
+    (*this)[new_key].swap(value);
 }
+
+const std::string* XmlAttributes::find_value(const std::string& key) const
+{
+    const_iterator itr = find(key);
+
+    if (itr == m_values.end())
+        return NULL;
+
+    return &itr->second;
+}
+
 }
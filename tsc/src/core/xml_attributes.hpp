@@ -21,22 +21,46 @@
 
 namespace TSC {
 
-    class XmlAttributes: public std::map<std::string, std::string> {
+    /* Properties of one XML element
+     * The loaders collect a handful of <property> elements per element, so
+     * the pairs are kept in a small vector instead of a tree. Lookups compare
+     * the few keys linearly and clear() keeps the memory for the next element.
+     * The map interface used by the loaders is kept, iteration is in insertion
+     * order. Keys are plain strings, most property names fit in the
+     * small string buffer.
+    */
+    class XmlAttributes {
     public:
+        struct value_type {
+            value_type(const std::string& key, const std::string& value)
+                : first(key), second(value) {}
+
+            std::string first;
+            std::string second;
+        };
+
+        typedef std::vector<value_type>::iterator iterator;
+        typedef std::vector<value_type>::const_iterator const_iterator;
+
         // If the given key `attribute_name' has the value `filename_old'
         //(either with or without the pixmaps dir), replace it with `filename_new'.
         void relocate_image(const std::string& filename_old, const std::string& filename_new, const std::string& attribute_name = "image");
 
         // Returns true if the given key exists, false otherwise.
-        bool exists(const std::string& key);
+        inline bool exists(const std::string& key) const
+        {
+            return find_value(key) != NULL;
+        }
 
         // If the given `key' exists, return its value. Otherwise return `defaultvalue'.
         // For strings, an this template is overriden to do no conversion at all.
         template <typename T>
-        T fetch(const std::string& key, T defaultvalue)
+        T fetch(const std::string& key, T defaultvalue) const
         {
-            if (exists(key))
-                return string_to_type<T>((*this)[key]);
+            const std::string* value = find_value(key);
+
+            if (value)
+                return string_to_type<T>(*value);
             else
                 return defaultvalue;
         }
@@ -45,29 +69,94 @@ namespace TSC {
         // type indicated by the template. If it doesn’t exist,
         // throw an instance of
         template <typename T>
-        T retrieve(const std::string& key)
+        T retrieve(const std::string& key) const
         {
-            if (exists(key))
-                return string_to_type<T>((*this)[key]);
+            const std::string* value = find_value(key);
+
+            if (value)
+                return string_to_type<T>(*value);
             else
                 throw (XmlKeyDoesNotExist(key));
         }
+
+        // Returns the value of `key', adds an empty value if it doesn't exist.
+        std::string& operator[](const std::string& key);
+
+        iterator find(const std::string& key);
+        const_iterator find(const std::string& key) const;
+
+        // Returns 1 if the given key exists, 0 otherwise.
+        inline size_t count(const std::string& key) const
+        {
+            return find_value(key) ? 1 : 0;
+        }
+
+        // Removes the given key and returns the number of removed values.
+        size_t erase(const std::string& key);
+
+        /* Moves the value of `old_key' to `new_key' and removes `old_key'.
+         * Use this instead of attributes[new_key] = attributes[old_key] as
+         * adding a key invalidates the references to the other values.
+         */
+        void rename(const std::string& old_key, const std::string& new_key);
+
+        // Removes all values but keeps the memory.
+        inline void clear()
+        {
+            m_values.clear();
+        }
+
+        inline size_t size() const
+        {
+            return m_values.size();
+        }
+        inline bool empty() const
+        {
+            return m_values.empty();
+        }
+
+        inline iterator begin()
+        {
+            return m_values.begin();
+        }
+        inline iterator end()
+        {
+            return m_values.end();
+        }
+        inline const_iterator begin() const
+        {
+            return m_values.begin();
+        }
+        inline const_iterator end() const
+        {
+            return m_values.end();
+        }
+
+    private:
+        // Returns the value of `key' or NULL if it doesn't exist
+        const std::string* find_value(const std::string& key) const;
+
+        std::vector<value_type> m_values;
     };
 
     template<>
-    inline std::string XmlAttributes::fetch(const std::string& key, std::string defaultvalue)
+    inline std::string XmlAttributes::fetch(const std::string& key, std::string defaultvalue) const
     {
-        if (exists(key))
-            return (*this)[key];
+        const std::string* value = find_value(key);
+
+        if (value)
+            return *value;
         else
             return defaultvalue;
     }
 
     template<>
-    inline const char* XmlAttributes::fetch(const std::string& key, const char* defaultvalue)
+    inline const char* XmlAttributes::fetch(const std::string& key, const char* defaultvalue) const
     {
-        if (exists(key))
-            return (*this)[key].c_str();
+        const std::string* value = find_value(key);
+
+        if (value)
+            return value->c_str();
         else
             return defaultvalue;
     }
@@ -64,14 +64,14 @@ void cBeetle::Init()
     m_editor_pos_z = 0.089f;
     m_name = "Beetle";
     m_velx = -2.5;
-    m_rest_living_time = Get_Random_Float(150.0f, 250.0f);
+    m_rest_living_time = Get_Random_Float(150.0f, 250.0f, RANDOM_STREAM_ENEMIES);
     m_start_direction = m_direction = DIR_LEFT;
     m_generation_max_y = 0.0f;
     m_generation_in_progress = false;
 
     // Select random color
     DefaultColor ary[] = {COL_RED, COL_YELLOW, COL_GREEN, COL_BLUE, COL_VIOLET};
-    Set_Color(ary[rand() % 5]);
+    Set_Color(ary[Get_Random_Int(5, RANDOM_STREAM_ENEMIES)]);
 
     m_state = STA_FLY;
     Set_Direction(DIR_LEFT);
@@ -142,9 +142,9 @@ void cBeetle::Update()
         }
 
         // Make it go into random directions on random occasions
-        if (rand() % 10 > 6) {
-            m_velx = Get_Random_Float(-10.0f, 10.0f);
-            m_vely = Get_Random_Float(-10.0f, 10.0f);
+        if (Get_Random_Int(10, RANDOM_STREAM_ENEMIES) > 6) {
+            m_velx = Get_Random_Float(-10.0f, 10.0f, RANDOM_STREAM_ENEMIES);
+            m_vely = Get_Random_Float(-10.0f, 10.0f, RANDOM_STREAM_ENEMIES);
 
             // Can’t use Set_Direction, because we set m_velx ourselves.
             // Therefore we also need to call Update_Rotation_Hor() ourselves.
@@ -159,9 +159,9 @@ void cEnemy::Update_Late(void)
 
         // handle collisions manually
         m_massive_type = MASS_MASSIVE;
-        cObjectCollisionType* col_list = Collision_Check(&m_col_rect);
-        Add_Collisions(col_list, 1);
-        delete col_list;
+        cObjectCollisionType col_list;
+        Collision_Check(col_list, m_col_rect);
+        Add_Collisions(&col_list, 1);
         Handle_Collisions();
         m_massive_type = MASS_PASSIVE;
     }
@@ -207,12 +207,12 @@ void cEnemy::Generate_Hit_Animation(cParticle_Emitter* anim /* = NULL */) const
     anim->Set_Quota(4);
     anim->Set_Pos_Z(m_pos_z - m_pos_z_delta);
     anim->Set_Time_to_Live(0.3f);
-    Color col_rand = Color(static_cast<uint8_t>(rand() % 5), rand() % 5, rand() % 100, 0);
+    Color col_rand = Color(static_cast<uint8_t>(Get_Random_Int(5, RANDOM_STREAM_ENEMIES)), Get_Random_Int(5, RANDOM_STREAM_ENEMIES), Get_Random_Int(100, RANDOM_STREAM_ENEMIES), 0);
     // not bright enough
     /*if( col_rand.red + col_rand.green + col_rand.blue < 250 )
     {
         // boost a random color
-        unsigned int rand_color = ( rand() % 3 );
+        unsigned int rand_color = Get_Random_Int(3, RANDOM_STREAM_ENEMIES);
 
         // yellow
         if( rand_color == 0 )
@@ -357,11 +357,11 @@ void cEnemy::Ball_Destroy_Animation(const cBall& ball)
             Color anim_color, anim_color_rand;
             if (ball.m_ball_type == FIREBALL_DEFAULT) {
                 anim_color = Color(static_cast<uint8_t>(250), 170, 150);
-                anim_color_rand = Color(static_cast<uint8_t>(rand() % 5), rand() % 85, rand() % 25, 0);
+                anim_color_rand = Color(static_cast<uint8_t>(Get_Random_Int(5, RANDOM_STREAM_ENEMIES)), Get_Random_Int(85, RANDOM_STREAM_ENEMIES), Get_Random_Int(25, RANDOM_STREAM_ENEMIES), 0);
             }
             else {
                 anim_color = Color(static_cast<uint8_t>(150), 150, 240);
-                anim_color_rand = Color(static_cast<uint8_t>(rand() % 80), rand() % 80, rand() % 10, 0);
+                anim_color_rand = Color(static_cast<uint8_t>(Get_Random_Int(80, RANDOM_STREAM_ENEMIES)), Get_Random_Int(80, RANDOM_STREAM_ENEMIES), Get_Random_Int(10, RANDOM_STREAM_ENEMIES), 0);
             }
             anim->Set_Color(anim_color, anim_color_rand);
             anim->Emit();
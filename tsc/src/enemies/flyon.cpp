@@ -93,8 +93,10 @@ void cFlyon::Init(void)
     m_kill_sound = "enemy/flyon/die.ogg";
     m_kill_points = 100;
 
-    m_wait_time = Get_Random_Float(0.0f, 70.0f);
+    m_wait_time = Get_Random_Float(0.0f, 70.0f, RANDOM_STREAM_ENEMIES);
     m_move_back = 0;
+    m_parallel_think = 1;
+    m_think_player_front = 0;
 }
 
 cFlyon* cFlyon::Copy(void) const
@@ -278,6 +280,31 @@ void cFlyon::Set_Moving_State(Moving_state new_state)
     m_state = new_state;
 }
 
+void cFlyon::Think(void)
+{
+    GL_rect rect1 = m_col_rect;
+
+    if (m_direction == DIR_UP) {
+        rect1.m_y -= 40.0f;
+        rect1.m_h += 40.0f;
+    }
+    else if (m_direction == DIR_DOWN) {
+        rect1.m_y += 40.0f;
+        rect1.m_h -= 40.0f;
+    }
+    else if (m_direction == DIR_LEFT) {
+        rect1.m_x -= 35.0f;
+        rect1.m_w += 35.0f;
+    }
+    else if (m_direction == DIR_RIGHT) {
+        rect1.m_x += 35.0f;
+        rect1.m_w += 35.0f;
+    }
+
+    // if player is in front
+    m_think_player_front = pLevel_Player->m_alex_type != ALEX_GHOST && pLevel_Player->m_col_rect.Intersects(rect1);
+}
+
 void cFlyon::Update(void)
 {
     cEnemy::Update();
@@ -300,27 +327,10 @@ void cFlyon::Update(void)
         }
         // no more waiting try to jump out
         else {
-            GL_rect rect1 = m_col_rect;
-
-            if (m_direction == DIR_UP) {
-                rect1.m_y -= 40.0f;
-                rect1.m_h += 40.0f;
-            }
-            else if (m_direction == DIR_DOWN) {
-                rect1.m_y += 40.0f;
-                rect1.m_h -= 40.0f;
-            }
-            else if (m_direction == DIR_LEFT) {
-                rect1.m_x -= 35.0f;
-                rect1.m_w += 35.0f;
-            }
-            else if (m_direction == DIR_RIGHT) {
-                rect1.m_x += 35.0f;
-                rect1.m_w += 35.0f;
-            }
+            Prepare_Think();
 
             // if player is in front: wait again
-            if (pLevel_Player->m_alex_type != ALEX_GHOST && pLevel_Player->m_col_rect.Intersects(rect1)) {
+            if (m_think_player_front) {
                 m_wait_time = speedfactor_fps * 2;
             }
             // if not: jump out
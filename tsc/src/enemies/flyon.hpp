@@ -71,6 +71,8 @@ namespace TSC {
         void Set_Moving_State(Moving_state new_state);
 
         // update
+        // check if the player is in front
+        virtual void Think(void);
         virtual void Update(void);
         // draw
         virtual void Draw(cSurface_Request* request = NULL);
@@ -119,6 +121,8 @@ namespace TSC {
         float m_wait_time;
         // moving back to the original position
         bool m_move_back;
+        // set by Think if the player is in front
+        bool m_think_player_front;
 
         // Save to XML node
         virtual xmlpp::Element* Save_To_XML_Node(xmlpp::Element* p_element);
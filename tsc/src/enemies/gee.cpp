@@ -95,6 +95,8 @@ void cGee::Init(void)
     m_wait_time_counter = 0.0f;
     m_fly_distance_counter = 0.0f;
     m_clouds_counter = 0.0f;
+    m_parallel_think = 1;
+    m_think_max_distance = 0;
 }
 
 cGee* cGee::Copy(void) const
@@ -278,7 +280,7 @@ void cGee::Set_Moving_State(Moving_state new_state)
         // set velocity
         if (m_start_direction == DIR_HORIZONTAL) {
             // randomize direction
-            if (rand() % 2 != 1) {
+            if (Get_Random_Int(2, RANDOM_STREAM_ENEMIES) != 1) {
                 m_direction = DIR_RIGHT;
                 m_velx = m_speed_fly;
             }
@@ -293,7 +295,7 @@ void cGee::Set_Moving_State(Moving_state new_state)
             m_velx = 0.0f;
 
             // randomize direction
-            if (rand() % 2 != 1) {
+            if (Get_Random_Int(2, RANDOM_STREAM_ENEMIES) != 1) {
                 m_direction = DIR_DOWN;
                 m_vely = m_speed_fly;
             }
@@ -309,6 +311,11 @@ void cGee::Set_Moving_State(Moving_state new_state)
     m_state = new_state;
 }
 
+void cGee::Think(void)
+{
+    m_think_max_distance = Is_At_Max_Distance();
+}
+
 void cGee::Update(void)
 {
     cEnemy::Update();
@@ -344,8 +351,10 @@ void cGee::Update(void)
             m_fly_distance_counter -= m_vely * pFramerate->m_speed_factor;
         }
 
+        Prepare_Think();
+
         // walk_distance reached or if beyond max distance
-        if ((!m_always_fly && m_fly_distance_counter > m_fly_distance) || Is_At_Max_Distance()) {
+        if ((!m_always_fly && m_fly_distance_counter > m_fly_distance) || m_think_max_distance) {
             Stop();
         }
 
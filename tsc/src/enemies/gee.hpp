@@ -71,6 +71,8 @@ namespace TSC {
         void Set_Moving_State(Moving_state new_state);
 
         // update
+        // check the maximum distance
+        virtual void Think(void);
         virtual void Update(void);
         // draw
         virtual void Draw(cSurface_Request* request = NULL);
@@ -135,6 +137,8 @@ namespace TSC {
         float m_fly_distance_counter;
         // clouds particle counter
         float m_clouds_counter;
+        // set by Think if beyond the maximum distance
+        bool m_think_max_distance;
 
         // Save to XML node
         virtual xmlpp::Element* Save_To_XML_Node(xmlpp::Element* p_element);
@@ -100,6 +100,9 @@ void cRokko::Init(void)
     Add_Image_Set("break", "enemy/rokko/yellow/break.imgset", 0, NULL, &m_break_end);
 
     Set_Image_Set("fly", true);
+
+    m_parallel_think = 1;
+    m_think_player_front = 0;
 }
 
 cRokko* cRokko::Copy(void) const
@@ -288,6 +291,11 @@ void cRokko::Update_Instant_Dying()
     Update_Normal_Dying();
 }
 
+void cRokko::Think(void)
+{
+    m_think_player_front = pLevel_Player->m_alex_type != ALEX_GHOST && pLevel_Player->m_col_rect.Intersects(Get_Final_Distance_Rect());
+}
+
 void cRokko::Update(void)
 {
     cEnemy::Update();
@@ -305,11 +313,12 @@ void cRokko::Update(void)
         // Do not self-activate when manual triggering is enabled
         if (m_manual)
             return;
-        // Do not activate if Alex is a ghost
-        else if (pLevel_Player->m_alex_type == ALEX_GHOST)
-            return;
+
+        Prepare_Think();
+
         // if player is in front then activate
-        else if (pLevel_Player->m_col_rect.Intersects(Get_Final_Distance_Rect()))
+        // Do not activate if Alex is a ghost
+        if (m_think_player_front)
             Activate();
         // Do not activate if Alex is not near by
         else
@@ -346,7 +355,7 @@ void cRokko::Draw(cSurface_Request* request /* = NULL */)
     if (!request) {
         create_request = 1;
         // create request
-        request = new cSurface_Request();
+        request = pRenderer->Alloc<cSurface_Request>();
     }
 
     // Draw
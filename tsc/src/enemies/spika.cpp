@@ -71,6 +71,8 @@ void cSpika::Init(void)
     m_speed = 0.0f;
     m_detection_size = 0.0f;
     m_walk_count = 0.0f;
+    m_parallel_think = 1;
+    m_think_player_direction = DIR_UNDEFINED;
 
     m_color_type = COL_DEFAULT;
     Set_Color(COL_ORANGE);
@@ -176,19 +178,14 @@ void cSpika::DownGrade(bool force /* = 0 */)
     }
 }
 
-void cSpika::Update(void)
+void cSpika::Think(void)
 {
-    cEnemy::Update();
+    m_think_player_direction = DIR_UNDEFINED;
 
-    if (!m_valid_update || !Is_In_Range()) {
+    if (pLevel_Player->m_alex_type == ALEX_GHOST) {
         return;
     }
 
-    // update rotation
-    if (m_velx != 0) {
-        Add_Rotation_Z((m_velx / (m_image->m_w * 0.01f)) * pFramerate->m_speed_factor);
-    }
-
     // check for player
     GL_rect player_rect = pLevel_Player->m_col_rect;
     player_rect.m_x += (pLevel_Player->m_col_rect.m_w / 2);
@@ -207,9 +204,31 @@ void cSpika::Update(void)
     rect_right.m_x -= m_col_rect.m_w / 2;
     rect_right.m_w += m_detection_size;
 
+    if (player_rect.Intersects(rect_left)) {
+        m_think_player_direction = DIR_LEFT;
+    }
+    else if (player_rect.Intersects(rect_right)) {
+        m_think_player_direction = DIR_RIGHT;
+    }
+}
+
+void cSpika::Update(void)
+{
+    cEnemy::Update();
+
+    if (!m_valid_update || !Is_In_Range()) {
+        return;
+    }
+
+    // update rotation
+    if (m_velx != 0) {
+        Add_Rotation_Z((m_velx / (m_image->m_w * 0.01f)) * pFramerate->m_speed_factor);
+    }
+
+    Prepare_Think();
 
     // if player is left
-    if (pLevel_Player->m_alex_type != ALEX_GHOST && player_rect.Intersects(rect_left)) {
+    if (m_think_player_direction == DIR_LEFT) {
         if (m_velx > -m_speed) {
             m_velx -= m_speed * 0.1f * pFramerate->m_speed_factor;
 
@@ -219,7 +238,7 @@ void cSpika::Update(void)
         }
     }
     // if player is right
-    else if (pLevel_Player->m_alex_type != ALEX_GHOST && player_rect.Intersects(rect_right)) {
+    else if (m_think_player_direction == DIR_RIGHT) {
         if (m_velx < m_speed) {
             m_velx += m_speed * 0.1f * pFramerate->m_speed_factor;
 
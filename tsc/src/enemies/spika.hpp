@@ -56,6 +56,8 @@ namespace TSC {
         */
         virtual void DownGrade(bool force = 0);
 
+        // find the player direction
+        virtual void Think(void);
         // update
         virtual void Update(void);
 
@@ -83,6 +85,8 @@ namespace TSC {
 
         // counter for walking
         float m_walk_count;
+        // direction of the detected player from Think or DIR_UNDEFINED
+        ObjectDirection m_think_player_direction;
 
         // Save to XML node
         virtual xmlpp::Element* Save_To_XML_Node(xmlpp::Element* p_element);
@@ -210,7 +210,7 @@ void cSpikeball::Set_Moving_State(Moving_state new_state)
     }
     else if (new_state == STA_WALK) {
         m_counter_running = 0.0f;
-        m_counter_walk = Get_Random_Float(0.0f, 80.0f);
+        m_counter_walk = Get_Random_Float(0.0f, 80.0f, RANDOM_STREAM_ENEMIES);
 
         Set_Image_Set("walk");
         Set_Animation_Speed(1.0);
@@ -256,7 +256,7 @@ void cSpikeball::Update(void)
             Set_Image_Set("turn");
 
             // random direction
-            if ((rand() % 2) == 1) {
+            if (Get_Random_Int(2, RANDOM_STREAM_ENEMIES) == 1) {
                 // turn around
                 m_direction = Get_Opposite_Direction(m_direction);
                 Update_Rotation_Hor();
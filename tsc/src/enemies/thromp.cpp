@@ -96,6 +96,9 @@ void cThromp::Init(void)
 
     m_kill_sound = "enemy/thromp/die.ogg";
     m_kill_points = 200;
+
+    m_parallel_think = 1;
+    m_think_player_front = 0;
 }
 
 cThromp* cThromp::Copy(void) const
@@ -268,6 +271,11 @@ void cThromp::Update_Normal_Dying()
     Set_Active(false);
 }
 
+void cThromp::Think(void)
+{
+    m_think_player_front = pLevel_Player->m_alex_type != ALEX_GHOST && pLevel_Player->m_col_rect.Intersects(Get_Final_Distance_Rect());
+}
+
 void cThromp::Update(void)
 {
     cEnemy::Update();
@@ -281,10 +289,10 @@ void cThromp::Update(void)
 
     // standing ( waiting )
     if (m_state == STA_STAY) {
-        GL_rect final_distance = Get_Final_Distance_Rect();
+        Prepare_Think();
 
         // if player is in front then activate
-        if (pLevel_Player->m_alex_type != ALEX_GHOST && pLevel_Player->m_col_rect.Intersects(final_distance)) {
+        if (m_think_player_front) {
             Activate();
         }
     }
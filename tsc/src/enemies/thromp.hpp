@@ -73,6 +73,8 @@ namespace TSC {
         virtual void Update_Normal_Dying(void);
 
         // update
+        // check if the player is in front
+        virtual void Think(void);
         virtual void Update(void);
         // draw
         virtual void Draw(cSurface_Request* request = NULL);
@@ -131,6 +133,8 @@ namespace TSC {
         bool m_move_back;
         // distance rect to end position
         GL_rect m_distance_rect;
+        // set by Think if the player is in the distance rect
+        bool m_think_player_front;
 
         // Save to XML node
         virtual xmlpp::Element* Save_To_XML_Node(xmlpp::Element* p_element);
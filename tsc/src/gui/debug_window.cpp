@@ -24,6 +24,8 @@
 #include "../overworld/overworld.hpp"
 #include "../objects/bonusbox.hpp"
 #include "../scene/scene.hpp"
+#include "../video/gl_state.hpp"
+#include "../video/animation.hpp"
 #include "debug_window.hpp"
 
 // extern
@@ -214,4 +216,23 @@ void cDebug_Window::Update()
              _("Game Mode: %d"),
              Game_Mode);
     mp_debugwin_root->getChild("game_mode")->setText(reinterpret_cast<const CEGUI::utf8*>(buf));
+
+    snprintf(buf,
+             4096,
+             _("GL state changes: %u Avoided: %u"),
+             pGL_State->m_done_changes,
+             pGL_State->m_avoided_changes);
+    mp_debugwin_root->getChild("render")->setText(reinterpret_cast<const CEGUI::utf8*>(buf));
+
+    if (pActive_Animation_Manager) {
+        snprintf(buf,
+                 4096,
+                 _("Particles: %u Budget: %u"),
+                 pActive_Animation_Manager->m_particle_count,
+                 pActive_Animation_Manager->m_particle_budget);
+    }
+    else {
+        snprintf(buf, 4096, "--");
+    }
+    mp_debugwin_root->getChild("particles")->setText(reinterpret_cast<const CEGUI::utf8*>(buf));
 }
@@ -373,7 +373,7 @@ void Draw_Static_Text(const std::string& text, const Color* color_text /* = &whi
         // draw background
         if (color_bg) {
             // create request
-            cRect_Request* request = new cRect_Request();
+            cRect_Request* request = pRenderer->Alloc<cRect_Request>();
 
             pVideo->Draw_Rect(NULL, 0.9f, color_bg, request);
             request->m_render_count = wait_for_input ? 4 : 1;
@@ -3569,7 +3569,7 @@ void cMenu_Credits::Draw(void)
     cMenu_Base::Draw();
 
     // darken background
-    cRect_Request* request = new cRect_Request();
+    cRect_Request* request = pRenderer->Alloc<cRect_Request>();
     pVideo->Draw_Rect(NULL, 0.095f, &pMenuCore->m_handler->m_level->m_background_manager->Get_Pointer(0)->m_color_2, request);
     request->m_color.red = static_cast<uint8_t>(request->m_color.red * 0.1f);
     request->m_color.green = static_cast<uint8_t>(request->m_color.green * 0.1f);
@@ -3671,7 +3671,7 @@ void cMenu_Credits::Menu_Fade(bool fade_in /* = 1 */)
         pMenuCore->m_animation_manager->Draw();
 
         // create request
-        cRect_Request* request = new cRect_Request();
+        cRect_Request* request = pRenderer->Alloc<cRect_Request>();
         pVideo->Draw_Rect(NULL, 0.095f, &pMenuCore->m_handler->m_level->m_background_manager->Get_Pointer(0)->m_color_2, request);
         request->m_color.red = static_cast<uint8_t>(request->m_color.red * 0.1f);
         request->m_color.green = static_cast<uint8_t>(request->m_color.green * 0.1f);
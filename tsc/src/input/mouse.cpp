@@ -1274,7 +1274,7 @@ void cMouseCursor::Draw_Object_Rects(void)
         obj_color = Get_Massive_Type_Color(m_hovering_object->m_obj->m_massive_type);
 
         // create request
-        cRect_Request* request = new cRect_Request();
+        cRect_Request* request = pRenderer->Alloc<cRect_Request>();
         pVideo->Draw_Rect(&hover_rect, 0.6f, &obj_color, request);
 
         if (m_fastcopy_mode) {
@@ -1327,7 +1327,7 @@ void cMouseCursor::Draw_Object_Rects(void)
             }
 
             // create request
-            cRect_Request* rect_request = new cRect_Request();
+            cRect_Request* rect_request = pRenderer->Alloc<cRect_Request>();
             pVideo->Draw_Rect(&hover_rect, pos_z, &obj_color, rect_request);
 
             rect_request->m_line_width = 2.0f;
@@ -1344,7 +1344,7 @@ void cMouseCursor::Draw_Object_Rects(void)
     // draw bounding box if multiple objects snapped at once
     if (m_left && m_snap_to_object_mode && m_selected_objects.size() > 1) {
         // create request
-        cRect_Request* rect_request = new cRect_Request();
+        cRect_Request* rect_request = pRenderer->Alloc<cRect_Request>();
         GL_rect sel_rect = Get_Selected_Objects_Rect();
         pVideo->Draw_Rect(sel_rect.m_x - pActive_Camera->m_x, sel_rect.m_y - pActive_Camera->m_y, sel_rect.m_w, sel_rect.m_h, 0.51f, &lightgrey, rect_request);
 
@@ -1452,7 +1452,7 @@ void cMouseCursor::Update_Selection(void)
     }
 
     // ## inner rect
-    cRect_Request* rect_request = new cRect_Request();
+    cRect_Request* rect_request = pRenderer->Alloc<cRect_Request>();
     pVideo->Draw_Rect(m_selection_rect.m_x - pActive_Camera->m_x + 0.5f, m_selection_rect.m_y - pActive_Camera->m_y + 0.5f, m_selection_rect.m_w, m_selection_rect.m_h, 0.509f, &white, rect_request);
 
     // not filled
@@ -1465,7 +1465,7 @@ void cMouseCursor::Update_Selection(void)
 
     // ## outer rect
     // create request
-    rect_request = new cRect_Request();
+    rect_request = pRenderer->Alloc<cRect_Request>();
     pVideo->Draw_Rect(m_selection_rect.m_x - pActive_Camera->m_x, m_selection_rect.m_y - pActive_Camera->m_y, m_selection_rect.m_w, m_selection_rect.m_h, 0.51f, &lightblue, rect_request);
 
     // not filled
@@ -54,6 +54,7 @@
 #include "../objects/text_box.hpp"
 #include "../objects/moving_platform.hpp"
 #include "../video/renderer.hpp"
+#include "../video/img_manager.hpp"
 #include "../core/math/utilities.hpp"
 #include "../core/i18n.hpp"
 #include "../objects/path.hpp"
@@ -64,6 +65,9 @@
 #include "../scripting/events/key_down_event.hpp"
 #include "../scripting/objects/misc/mrb_timer.hpp"
 #include "../core/global_basic.hpp"
+#include "../core/dispatch_benchmark.hpp"
+#include "level_preloader.hpp"
+#include "level_streamer.hpp"
 
 namespace fs = boost::filesystem;
 
@@ -108,6 +112,9 @@ cLevel::cLevel(void)
     m_mruby_has_been_initialized = false;
 
     m_sprite_manager = new cSprite_Manager();
+    // only update the objects near the camera
+    m_sprite_manager->m_use_activity_regions = 1;
+    m_streamer = NULL;
     m_background_manager = new cBackground_Manager();
     m_animation_manager = new cAnimation_Manager();
 
@@ -214,7 +221,15 @@ cLevel* cLevel::Load_From_File(fs::path filename)
 
     // supported level format
     if (filename.extension() == fs::path(".tsclvl")  || filename.extension() == fs::path(".smclvl")) {
-        loader.parse_file(filename);
+        cLevel_Cache preloaded;
+
+        // read in the background before
+        if (pLevel_Preloader && pLevel_Preloader->Take(filename, preloaded)) {
+            loader.parse_preloaded(filename, preloaded);
+        }
+        else {
+            loader.parse_file(filename);
+        }
     }
     else { // old, unsupported level format
         gp_hud->Set_Text(_("Unsupported Level format : ") + (const std::string)path_to_utf8(filename));
@@ -234,6 +249,11 @@ cLevel* cLevel::Load_From_File(fs::path filename)
         obj->Init_Links();
     }
 
+    // collision data of the immobile objects
+    p_level->m_sprite_manager->Build_Static_Collision();
+    // pack the newly loaded images
+    pImage_Manager->Build_Atlases();
+
     debug_print("Loaded level: %s\n", path_to_utf8(p_level->m_level_filename).c_str());
 
     return p_level;
@@ -254,6 +274,12 @@ void cLevel::Unload(bool delayed /* = 0 */)
         return;
     }
 
+    // the streamed sprites are deleted with the others
+    if (m_streamer) {
+        delete m_streamer;
+        m_streamer = NULL;
+    }
+
     // delete backgrounds
     m_background_manager->Delete_All();
 
@@ -294,6 +320,9 @@ void cLevel::Unload(bool delayed /* = 0 */)
 
 fs::path cLevel::Save_To_File(fs::path filename /* = fs::path() */)
 {
+    // all objects are saved
+    Stop_Streaming();
+
     xmlpp::Document doc;
     xmlpp::Element* p_root = doc.create_root_node("level");
     xmlpp::Element* p_node = NULL;
@@ -538,10 +567,12 @@ void cLevel::Enter(const GameMode old_mode /* = MODE_NOTHING */)
 
     // camera
     if (pLevel_Editor->m_enabled) {
+        Stop_Streaming();
         pActive_Camera->Update_Position();
     }
     else {
         pLevel_Manager->m_camera->Center();
+        Update_Streaming();
     }
 
     // Continue timers
@@ -613,15 +644,23 @@ void cLevel::Update(void)
         //Load( path_to_utf8(m_next_level_filename) );
     }
 
+    // remove the objects deleted in the last frame
+    m_sprite_manager->Compact();
+
     // if level-editor is not active
     if (!editor_level_enabled) {
+        // streamed objects
+        Update_Streaming();
+
         // backgrounds
         for (vector<cBackground*>::iterator itr = m_background_manager->objects.begin(); itr != m_background_manager->objects.end(); ++itr) {
             (*itr)->Update();
         }
 
         // objects
+        pDispatch_Benchmark->Begin();
         m_sprite_manager->Update_Items();
+        pDispatch_Benchmark->End(DISPATCH_UPDATE);
         // animations
         m_animation_manager->Update();
 
@@ -642,12 +681,45 @@ void cLevel::Update(void)
     }
 }
 
+void cLevel::Update_Streaming(void)
+{
+    if (!m_streamer) {
+        return;
+    }
+
+    // the player may be away from the camera after a warp
+    GL_rect rect = pActive_Camera->Get_Rect();
+    const GL_rect& player_rect = pLevel_Player->m_col_rect;
+
+    const float right = max(rect.m_x + rect.m_w, player_rect.m_x + player_rect.m_w);
+    const float bottom = max(rect.m_y + rect.m_h, player_rect.m_y + player_rect.m_h);
+    rect.m_x = min(rect.m_x, player_rect.m_x);
+    rect.m_y = min(rect.m_y, player_rect.m_y);
+    rect.m_w = right - rect.m_x;
+    rect.m_h = bottom - rect.m_y;
+
+    m_streamer->Update(rect);
+}
+
+void cLevel::Stop_Streaming(void)
+{
+    if (!m_streamer) {
+        return;
+    }
+
+    m_streamer->Load_All();
+    delete m_streamer;
+    m_streamer = NULL;
+}
+
 void cLevel::Update_Late(void)
 {
     // if leveleditor is not active
     if (!editor_level_enabled) {
         // objects
+        pDispatch_Benchmark->Begin();
         m_sprite_manager->Update_Items_Late();
+        pDispatch_Benchmark->End(DISPATCH_UPDATE_LATE);
     }
 }
 
@@ -666,7 +738,9 @@ void cLevel::Draw_Layer_1(LevelDrawType type /* = LVL_DRAW */)
     }
 
     // Objects
+    pDispatch_Benchmark->Begin();
     m_sprite_manager->Draw_Items();
+    pDispatch_Benchmark->End(DISPATCH_DRAW);
     // Animations
     m_animation_manager->Draw();
 }
@@ -681,7 +755,7 @@ void cLevel::Draw_Layer_2(LevelDrawType type /* = LVL_DRAW */)
     // ghost
     if (pLevel_Player->m_alex_type == ALEX_GHOST) {
         // create request
-        cRect_Request* request = new cRect_Request();
+        cRect_Request* request = pRenderer->Alloc<cRect_Request>();
 
         Color color = Color(0.5f, 0.5f, 0.5f, 0.3f);
 
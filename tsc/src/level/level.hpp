@@ -30,6 +30,8 @@ namespace TSC {
 
     /* *** *** *** *** *** cLevel *** *** *** *** *** *** *** *** *** *** *** *** */
 
+    class cLevel_Streamer;
+
     class cLevel {
     public:
 
@@ -153,6 +155,11 @@ namespace TSC {
         /// Convenience method for calling Pause_All_Timers(false).
         void Continue_All_Timers();
 
+        // Create the streamed objects near the camera and the player
+        void Update_Streaming(void);
+        // Create all streamed objects and stop streaming
+        void Stop_Streaming(void);
+
         static bool Is_Level_Object_Element(const CEGUI::String& element)
         {
             if (element == "information" || element == "settings" || element == "background" || element == "music" ||
@@ -183,6 +190,8 @@ namespace TSC {
         cAnimation_Manager* m_animation_manager;
         // sprite manager
         cSprite_Manager* m_sprite_manager;
+        // creates the static sprites near the camera only or NULL if not streamed
+        cLevel_Streamer* m_streamer;
         // MRuby interpreter used for this level
         Scripting::cMRuby_Interpreter* m_mruby;
         // Do not re-Init() on sublevel loading.
@@ -0,0 +1,297 @@
+/***************************************************************************
+ * level_cache.cpp - binary cache of parsed level XML
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "level_cache.hpp"
+#include "../core/property_helper.hpp"
+#include "../core/filesystem/resource_manager.hpp"
+#include "../core/filesystem/filesystem.hpp"
+#include "../core/global_basic.hpp"
+
+namespace fs = boost::filesystem;
+using namespace TSC;
+
+using namespace std;
+
+// increase if the record layout changes
+static const uint32_t level_cache_format_version = 1;
+static const char level_cache_magic[8] = {'T', 'S', 'C', 'L', 'V', 'L', 'C', '\0'};
+
+/***************************************
+ * Little-endian helpers
+ ***************************************/
+
+static void Write_Uint32(std::string& out, uint32_t val)
+{
+    for (unsigned int i = 0; i < 4; i++) {
+        out.push_back(static_cast<char>((val >> (i * 8)) & 0xFF));
+    }
+}
+
+static void Write_Uint64(std::string& out, uint64_t val)
+{
+    for (unsigned int i = 0; i < 8; i++) {
+        out.push_back(static_cast<char>((val >> (i * 8)) & 0xFF));
+    }
+}
+
+static void Write_String(std::string& out, const std::string& str)
+{
+    Write_Uint32(out, static_cast<uint32_t>(str.size()));
+    out.append(str);
+}
+
+static bool Read_Uint8(const std::string& in, size_t& pos, uint8_t& val)
+{
+    if (pos + 1 > in.size())
+        return false;
+
+    val = static_cast<uint8_t>(in[pos]);
+    pos += 1;
+    return true;
+}
+
+static bool Read_Uint32(const std::string& in, size_t& pos, uint32_t& val)
+{
+    if (pos + 4 > in.size())
+        return false;
+
+    val = 0;
+    for (unsigned int i = 0; i < 4; i++)
+        val |= static_cast<uint32_t>(static_cast<uint8_t>(in[pos + i])) << (i * 8);
+
+    pos += 4;
+    return true;
+}
+
+static bool Read_String(const std::string& in, size_t& pos, std::string& str)
+{
+    uint32_t size;
+
+    if (!Read_Uint32(in, pos, size) || pos + size > in.size())
+        return false;
+
+    str.assign(in, pos, size);
+    pos += size;
+    return true;
+}
+
+/***************************************
+ * cLevel_Cache
+ ***************************************/
+
+cLevel_Cache::cLevel_Cache()
+{
+}
+
+void cLevel_Cache::Add_Property(const std::string& key, const std::string& value)
+{
+    Record record;
+    record.m_type = LEVEL_CACHE_PROPERTY;
+    record.m_first = Get_String_Index(key);
+    record.m_second = Get_String_Index(value);
+    m_records.push_back(record);
+}
+
+void cLevel_Cache::Add_Element_End(const std::string& name)
+{
+    Record record;
+    record.m_type = LEVEL_CACHE_ELEMENT_END;
+    record.m_first = Get_String_Index(name);
+    record.m_second = 0;
+    m_records.push_back(record);
+}
+
+void cLevel_Cache::Add_Script(const std::string& text)
+{
+    Record record;
+    record.m_type = LEVEL_CACHE_SCRIPT;
+    record.m_first = Get_String_Index(text);
+    record.m_second = 0;
+    m_records.push_back(record);
+}
+
+void cLevel_Cache::Clear()
+{
+    m_records.clear();
+    m_strings.clear();
+    m_string_indexes.clear();
+}
+
+void cLevel_Cache::Swap(cLevel_Cache& other)
+{
+    m_records.swap(other.m_records);
+    m_strings.swap(other.m_strings);
+    m_string_indexes.swap(other.m_string_indexes);
+}
+
+uint32_t cLevel_Cache::Get_String_Index(const std::string& str)
+{
+    std::unordered_map<std::string, uint32_t>::const_iterator iter = m_string_indexes.find(str);
+
+    if (iter != m_string_indexes.end())
+        return iter->second;
+
+    const uint32_t index = static_cast<uint32_t>(m_strings.size());
+    m_strings.push_back(str);
+    m_string_indexes[str] = index;
+
+    return index;
+}
+
+std::string cLevel_Cache::Get_Header(const fs::path& level_file)
+{
+    boost::system::error_code error;
+    const std::time_t mtime = fs::last_write_time(level_file, error);
+    const uintmax_t size = fs::file_size(level_file, error);
+
+    std::string header(level_cache_magic, sizeof(level_cache_magic));
+    Write_Uint32(header, level_cache_format_version);
+    Write_Uint32(header, tsc_version);
+    Write_Uint32(header, static_cast<uint32_t>(level_engine_version));
+    Write_String(header, path_to_utf8(fs::absolute(level_file)));
+    Write_Uint64(header, static_cast<uint64_t>(mtime));
+    Write_Uint64(header, static_cast<uint64_t>(size));
+
+    return header;
+}
+
+fs::path cLevel_Cache::Get_Cache_Filename(const fs::path& level_file)
+{
+    // the full path is in the header to detect collisions
+    std::stringstream name;
+    name << std::hex << std::setw(16) << std::setfill('0') << static_cast<uint64_t>(std::hash<std::string>()(path_to_utf8(fs::absolute(level_file))));
+    name << "_" << path_to_utf8(level_file.stem()) << ".tsclvlc";
+
+    return pResource_Manager->Get_User_Levelcache_Directory() / utf8_to_path(name.str());
+}
+
+bool cLevel_Cache::Load(const fs::path& level_file)
+{
+    Clear();
+
+    const fs::path filename = Get_Cache_Filename(level_file);
+
+    if (!File_Exists(filename))
+        return false;
+
+    fs::ifstream file(filename, ios::in | ios::binary);
+
+    if (!file.is_open())
+        return false;
+
+    std::stringstream content;
+    content << file.rdbuf();
+    const std::string data = content.str();
+
+    // outdated or for another level file
+    const std::string header = Get_Header(level_file);
+
+    if (data.compare(0, header.size(), header) != 0)
+        return false;
+
+    size_t pos = header.size();
+    uint32_t count;
+
+    // strings, every string needs at least its size
+    if (!Read_Uint32(data, pos, count) || count > (data.size() - pos) / 4)
+        return false;
+
+    m_strings.resize(count);
+
+    for (uint32_t i = 0; i < count; i++) {
+        if (!Read_String(data, pos, m_strings[i])) {
+            Clear();
+            return false;
+        }
+    }
+
+    // records
+    while (1) {
+        uint8_t type;
+        Record record;
+        record.m_second = 0;
+
+        if (!Read_Uint8(data, pos, type))
+            break;
+
+        record.m_type = static_cast<LevelCacheRecord>(type);
+
+        // done
+        if (record.m_type == LEVEL_CACHE_END)
+            return true;
+
+        if (record.m_type != LEVEL_CACHE_PROPERTY && record.m_type != LEVEL_CACHE_ELEMENT_END && record.m_type != LEVEL_CACHE_SCRIPT)
+            break;
+        if (!Read_Uint32(data, pos, record.m_first) || record.m_first >= count)
+            break;
+        if (record.m_type == LEVEL_CACHE_PROPERTY && (!Read_Uint32(data, pos, record.m_second) || record.m_second >= count))
+            break;
+
+        m_records.push_back(record);
+    }
+
+    // truncated or damaged
+    cerr << "Warning: Ignoring damaged level cache " << path_to_utf8(filename) << endl;
+    Clear();
+    return false;
+}
+
+bool cLevel_Cache::Save(const fs::path& level_file) const
+{
+    std::string data = Get_Header(level_file);
+
+    Write_Uint32(data, static_cast<uint32_t>(m_strings.size()));
+
+    for (std::vector<std::string>::const_iterator iter = m_strings.begin(); iter != m_strings.end(); iter++)
+        Write_String(data, *iter);
+
+    for (std::vector<Record>::const_iterator iter = m_records.begin(); iter != m_records.end(); iter++) {
+        data.push_back(static_cast<char>(iter->m_type));
+        Write_Uint32(data, iter->m_first);
+
+        if (iter->m_type == LEVEL_CACHE_PROPERTY)
+            Write_Uint32(data, iter->m_second);
+    }
+
+    data.push_back(static_cast<char>(LEVEL_CACHE_END));
+
+    // write a temporary file first to never leave a partial cache behind
+    const fs::path filename = Get_Cache_Filename(level_file);
+    fs::path temp_filename = filename;
+    temp_filename += ".tmp";
+
+    {
+        fs::ofstream file(temp_filename, ios::out | ios::binary | ios::trunc);
+
+        if (!file.is_open())
+            return false;
+
+        file.write(data.data(), data.size());
+
+        if (!file.good())
+            return false;
+    }
+
+    boost::system::error_code error;
+    fs::rename(temp_filename, filename, error);
+
+    if (error) {
+        cerr << "Warning: Could not write level cache " << path_to_utf8(filename) << ": " << error.message() << endl;
+        fs::remove(temp_filename, error);
+        return false;
+    }
+
+    return true;
+}
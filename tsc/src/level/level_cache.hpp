@@ -0,0 +1,95 @@
+/***************************************************************************
+ * level_cache.hpp - binary cache of parsed level XML
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TSC_LEVEL_CACHE_HPP
+#define TSC_LEVEL_CACHE_HPP
+#include "../core/global_game.hpp"
+
+namespace TSC {
+
+    // Record types of the level cache
+    enum LevelCacheRecord {
+        // end of the records
+        LEVEL_CACHE_END = 0,
+        // <property> with the key and value string
+        LEVEL_CACHE_PROPERTY = 1,
+        // closed element with the name string
+        LEVEL_CACHE_ELEMENT_END = 2,
+        // <script> text string
+        LEVEL_CACHE_SCRIPT = 3
+    };
+
+    /**
+     * Binary copy of what cLevelLoader reads from a level XML file.
+     *
+     * The file is a versioned little-endian stream. The header identifies
+     * the level file by its path, modification time and size and holds the
+     * engine version it was written by. A changed level file or a new engine
+     * version makes the cache invalid and the XML is parsed again. All
+     * strings are stored once in a string table, the records only hold
+     * their indexes. The XML file is never written from the cache.
+     */
+    class cLevel_Cache {
+    public:
+        struct Record {
+            LevelCacheRecord m_type;
+            // string indexes
+            uint32_t m_first;
+            uint32_t m_second;
+        };
+
+        cLevel_Cache();
+
+        // Add a record
+        void Add_Property(const std::string& key, const std::string& value);
+        void Add_Element_End(const std::string& name);
+        void Add_Script(const std::string& text);
+
+        // Remove all records and strings
+        void Clear();
+        // Exchange the records and strings with the other cache
+        void Swap(cLevel_Cache& other);
+
+        /* Load the cache of the given level file
+         * returns false if there is no valid cache for the current file
+        */
+        bool Load(const boost::filesystem::path& level_file);
+        // Save as cache of the given level file, returns false on failure
+        bool Save(const boost::filesystem::path& level_file) const;
+
+        // Return the string of the given index
+        inline const std::string& Get_String(uint32_t index) const
+        {
+            return m_strings[index];
+        }
+
+        // Return the cache filename of the given level file
+        static boost::filesystem::path Get_Cache_Filename(const boost::filesystem::path& level_file);
+
+        std::vector<Record> m_records;
+
+    private:
+        // Return the index of the string and add it if new
+        uint32_t Get_String_Index(const std::string& str);
+        // Return the header identifying the given level file
+        static std::string Get_Header(const boost::filesystem::path& level_file);
+
+        std::vector<std::string> m_strings;
+        std::unordered_map<std::string, uint32_t> m_string_indexes;
+    };
+
+}
+
+#endif
@@ -77,6 +77,9 @@ void cEditor_Level::Enable(cSprite_Manager* p_sprite_manager)
     if (m_enabled)
         return;
 
+    // every object has to be editable
+    mp_level->Stop_Streaming();
+
     cEditor::Enable(p_sprite_manager);
     mp_level->Pause_All_Timers();
     m_focused_exit = 0;
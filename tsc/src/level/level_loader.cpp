@@ -14,6 +14,7 @@
 */
 
 #include "level_loader.hpp"
+#include "level_streamer.hpp"
 #include "level_player.hpp"
 #include "../core/sprite_manager.hpp"
 #include "../core/property_helper.hpp"
@@ -54,6 +55,7 @@
 #include "../objects/lava.hpp"
 #include "../objects/crate.hpp"
 #include "../core/global_basic.hpp"
+#include "../user/preferences.hpp"
 
 namespace fs = boost::filesystem;
 using namespace TSC;
@@ -65,6 +67,8 @@ cLevelLoader::cLevelLoader()
 {
     mp_level    = NULL;
     m_in_script_tag = false;
+    m_record_cache = false;
+    m_record_only = false;
 }
 
 cLevelLoader::~cLevelLoader()
@@ -86,25 +90,97 @@ cLevel* cLevelLoader::Get_Level()
 void cLevelLoader::parse_file(boost::filesystem::path filename)
 {
     m_levelfile = filename;
+
+    if (pPreferences->m_level_cache_enabled) {
+        if (m_cache.Load(filename)) {
+            Parse_Cache();
+            return;
+        }
+
+        m_record_cache = true;
+    }
+
     xmlpp::SaxParser::parse_file(path_to_utf8(filename));
+
+    if (m_record_cache) {
+        m_cache.Save(filename);
+        m_cache.Clear();
+        m_record_cache = false;
+    }
+}
+
+void cLevelLoader::parse_preloaded(boost::filesystem::path filename, cLevel_Cache& cache)
+{
+    m_levelfile = filename;
+    m_cache.Swap(cache);
+    Parse_Cache();
+}
+
+void cLevelLoader::Preload_File(boost::filesystem::path filename, cLevel_Cache& cache)
+{
+    if (pPreferences->m_level_cache_enabled && cache.Load(filename))
+        return;
+
+    cLevelLoader loader;
+    loader.m_levelfile = filename;
+    loader.m_record_cache = true;
+    loader.m_record_only = true;
+    loader.xmlpp::SaxParser::parse_file(path_to_utf8(filename));
+
+    if (pPreferences->m_level_cache_enabled)
+        loader.m_cache.Save(filename);
+
+    cache.Swap(loader.m_cache);
+}
+
+void cLevelLoader::Parse_Cache()
+{
+    on_start_document();
+
+    for (std::vector<cLevel_Cache::Record>::const_iterator iter = m_cache.m_records.begin(); iter != m_cache.m_records.end(); iter++) {
+        if (iter->m_type == LEVEL_CACHE_PROPERTY)
+            m_current_properties[m_cache.Get_String(iter->m_first)] = m_cache.Get_String(iter->m_second);
+        else if (iter->m_type == LEVEL_CACHE_ELEMENT_END)
+            Handle_End_Element(m_cache.Get_String(iter->m_first));
+        else if (iter->m_type == LEVEL_CACHE_SCRIPT)
+            mp_level->m_script.append(m_cache.Get_String(iter->m_first));
+    }
+
+    on_end_document();
+    m_cache.Clear();
 }
 
 void cLevelLoader::on_start_document()
 {
+    if (m_record_only)
+        return;
+
     if (mp_level)
         throw("Restarted XML parser after already starting it."); // FIXME: proper exception
 
     mp_level = new cLevel();
     m_in_script_tag = false;
+
+    if (pPreferences->m_level_streaming)
+        mp_level->m_streamer = new cLevel_Streamer(mp_level->m_sprite_manager);
 }
 
 void cLevelLoader::on_end_document()
 {
+    if (m_record_only)
+        return;
+
     mp_level->m_level_filename = m_levelfile;
 
     // engine version entry not set
     if (mp_level->m_engine_version < 0)
         mp_level->m_engine_version = 0;
+
+    // small levels are not streamed
+    if (mp_level->m_streamer && !mp_level->m_streamer->Finish_Loading(mp_level->m_script)) {
+        delete mp_level->m_streamer;
+        mp_level->m_streamer = NULL;
+    }
 }
 
 void cLevelLoader::on_start_element(const Glib::ustring& name, const xmlpp::SaxParser::AttributeList& properties)
@@ -126,7 +202,11 @@ void cLevelLoader::on_start_element(const Glib::ustring& name, const xmlpp::SaxP
                 value = attr.value;
         }
 
-        m_current_properties[key] = value;
+        if (!m_record_only)
+            m_current_properties[key] = value;
+
+        if (m_record_cache)
+            m_cache.Add_Property(key, value);
     }
     else if (name == "script") {
         // Indicate a script tag has opened, so we can retrieve
@@ -143,6 +223,21 @@ void cLevelLoader::on_end_element(const Glib::ustring& name)
     if (name == "property" || name == "Property")
         return;
 
+    if (m_record_cache)
+        m_cache.Add_Element_End(name);
+
+    if (m_record_only) {
+        if (name == "script")
+            m_in_script_tag = false;
+
+        return;
+    }
+
+    Handle_End_Element(name);
+}
+
+void cLevelLoader::Handle_End_Element(const std::string& name)
+{
     // Now for the real, cumbersome parsing process
     if (name == "information")
         Parse_Tag_Information();
@@ -152,7 +247,7 @@ void cLevelLoader::on_end_element(const Glib::ustring& name)
         Parse_Tag_Background();
     else if (name == "player")
         Parse_Tag_Player();
-    else if (cLevel::Is_Level_Object_Element(std::string(name))) // CEGUI doesn’t like Glib::ustring
+    else if (cLevel::Is_Level_Object_Element(name))
         Parse_Level_Object_Tag(name);
     else if (name == "level") {
         /* Ignore the root <level> tag */
@@ -173,8 +268,13 @@ void cLevelLoader::on_characters(const Glib::ustring& text)
     /* If we’re currently in the <script> tag, read its
      * text (may be called multiple times for each token,
      * so append rather then set directly). */
-    if (m_in_script_tag)
-        mp_level->m_script.append(text);
+    if (m_in_script_tag) {
+        if (!m_record_only)
+            mp_level->m_script.append(text);
+
+        if (m_record_cache)
+            m_cache.Add_Script(text);
+    }
 }
 
 /***************************************
@@ -259,6 +359,12 @@ void cLevelLoader::Parse_Tag_Player()
 
 void cLevelLoader::Parse_Level_Object_Tag(const std::string& name)
 {
+    // created when near the camera
+    if (mp_level->m_streamer && cLevel_Streamer::Is_Streamable(name)) {
+        mp_level->m_streamer->Add(name, m_current_properties, mp_level->m_engine_version);
+        return;
+    }
+
     // create sprite
     std::vector<cSprite*> sprites = Create_Level_Objects_From_XML_Tag(name, m_current_properties, mp_level->m_engine_version, mp_level->m_sprite_manager);
 
@@ -673,10 +779,7 @@ std::vector<cSprite*> cLevelLoader::Create_Boxes_From_XML_Tag(const std::string&
         attributes["item"]      = int_to_string(TYPE_GOLDPIECE);
 
         // Renamed old values
-        if (attributes.exists("color")) {
-            attributes["gold_color"] = attributes["color"];
-            attributes.erase("color");
-        }
+        attributes.rename("color", "gold_color");
 
         result.push_back(new cBonusBox(attributes, p_sprite_manager));
     }
@@ -876,9 +979,8 @@ std::vector<cSprite*> cLevelLoader::Create_Enemies_From_XML_Tag(const std::strin
         result.push_back(new cShell(attributes, p_sprite_manager));
     else if (type == "turtleboss") {
         // if V.1.5 and lower : max_downgrade_time changed to shell_time
-        if (engine_version < 27 && attributes.exists("max_downgrade_time")) {
-            attributes["shell_time"] = attributes["max_downgrade_time"];
-            attributes.erase("max_downgrade_time");
+        if (engine_version < 27) {
+            attributes.rename("max_downgrade_time", "shell_time");
         }
         result.push_back(new cTurtleBoss(attributes, p_sprite_manager));
     }
@@ -941,14 +1043,15 @@ std::vector<cSprite*> cLevelLoader::Create_Particle_Emitters_From_XML_Tag(const
     // Note : If you relocate images don't forget the global effect
 
     //Fix old emitter definitions
+    // copied as adding a key invalidates the references to the other values
     if (attributes.exists("pos_x"))
-        attributes["posx"] =  attributes["pos_x"];
+        attributes["posx"] = attributes.fetch<std::string>("pos_x", "");
     if (attributes.exists("pos_y"))
-        attributes["posy"] =  attributes["pos_y"];
+        attributes["posy"] = attributes.fetch<std::string>("pos_y", "");
     if (attributes.exists("size_x"))
-        attributes["sizex"] =  attributes["size_x"];
+        attributes["sizex"] = attributes.fetch<std::string>("size_x", "");
     if (attributes.exists("size_y"))
-        attributes["sizey"] =  attributes["size_y"];
+        attributes["sizey"] = attributes.fetch<std::string>("size_y", "");
 
     // if V.1.9 and lower : move y coordinate bottom to 0
     if (engine_version < 35 && attributes.exists("posy"))
@@ -963,14 +1066,12 @@ std::vector<cSprite*> cLevelLoader::Create_Particle_Emitters_From_XML_Tag(const
     }
 
     // if V.1.9 and lower : change file to image
-    if (engine_version < 38 && attributes.exists("file")) {
-        attributes["image"] = attributes["file"];
-        attributes.erase("file");
+    if (engine_version < 38) {
+        attributes.rename("file", "image");
     }
 
-    if (attributes.exists("image") && !attributes.exists("particle_image")) {
-        attributes["particle_image"] = attributes["image"] ;
-        attributes.erase("image");
+    if (!attributes.exists("particle_image")) {
+        attributes.rename("image", "particle_image");
     }
 
     cParticle_Emitter* p_emitter = new cParticle_Emitter(attributes, p_sprite_manager);
@@ -999,9 +1100,8 @@ std::vector<cSprite*> cLevelLoader::Create_Global_Effects_From_XML_Tag(const std
         attributes.erase("creation_speed");
     }
 
-    if (attributes.exists("image") && !attributes.exists("particle_image")) {
-        attributes["particle_image"] = attributes["image"] ;
-        attributes.erase("image");
+    if (!attributes.exists("particle_image")) {
+        attributes.rename("image", "particle_image");
     }
 
     // if V.1.9 and lower : change fire_1 animation to particles
@@ -18,6 +18,7 @@
 #include "../core/global_game.hpp"
 #include "../core/xml_attributes.hpp"
 #include "level.hpp"
+#include "level_cache.hpp"
 
 namespace TSC {
 
@@ -48,14 +49,22 @@ namespace TSC {
         // This method is static, because it must be accessible from the savegame loader
         // as well.
         static std::vector<cSprite*> Create_Level_Objects_From_XML_Tag(const std::string& name, XmlAttributes& attributes, int engine_version, cSprite_Manager* p_sprite_manager);
+        // Read the given file into `cache' without creating a level. This does
+        // not use OpenGL or any manager and can run on another thread. Uses
+        // and updates the level cache file if enabled. Throws like parse_file().
+        static void Preload_File(boost::filesystem::path filename, cLevel_Cache& cache);
 
         cLevelLoader();
         virtual ~cLevelLoader();
 
         // Parse the given filename. Use this function instead of bare xmlpp’s
         // parse_file() that accepts a Glib::ustring — this function sets
-        // some internal members.
+        // some internal members. If the level cache is enabled the cached
+        // copy of the file is used if still valid, otherwise it is created.
         virtual void parse_file(boost::filesystem::path filename);
+        // Build the level from a cache filled by Preload_File() instead of
+        // parsing the given file.
+        void parse_preloaded(boost::filesystem::path filename, cLevel_Cache& cache);
         // After finishing parsing, contains a pointer to a cLevel instance.
         // This pointer must be freed by you. Returns NULL before parsing.
         cLevel* Get_Level();
@@ -86,6 +95,11 @@ namespace TSC {
         static std::vector<cSprite*> Create_Lavas_From_XML_Tag(const std::string& name, XmlAttributes& attributes, int engine_version, cSprite_Manager* p_sprite_manager);
         static std::vector<cSprite*> Create_Crates_From_XML_Tag(const std::string& name, XmlAttributes& attributes, int engine_version, cSprite_Manager* p_sprite_manager);
 
+        // Handle a closed element other than <property>
+        void Handle_End_Element(const std::string& name);
+        // Build the level from the records of m_cache
+        void Parse_Cache();
+
         void Parse_Tag_Information();
         void Parse_Tag_Settings();
         void Parse_Tag_Background();
@@ -102,6 +116,12 @@ namespace TSC {
         XmlAttributes m_current_properties;
         // True if we’re currently parsing a <script> tag.
         bool m_in_script_tag;
+        // The binary level cache, filled while parsing the XML if
+        // m_record_cache is set.
+        cLevel_Cache m_cache;
+        bool m_record_cache;
+        // Only fill m_cache and do not create a level.
+        bool m_record_only;
     };
 
 }
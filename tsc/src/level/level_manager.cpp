@@ -31,6 +31,8 @@
 #include "../core/global_basic.hpp"
 #include "../gui/hud.hpp"
 #include "../gui/game_console.hpp"
+#include "../core/dispatch_benchmark.hpp"
+#include "level_preloader.hpp"
 
 using namespace std;
 
@@ -73,6 +75,11 @@ void cLevel_Manager::Unload(void)
     // disable fixed camera velocity
     pLevel_Manager->m_camera->m_fixed_hor_vel = 0.0f;
 
+    // levels read for the last game are not needed anymore
+    if (pLevel_Preloader) {
+        pLevel_Preloader->Clear();
+    }
+
     // always keep one level
     if (size() > 1) {
         for (vector<cLevel*>::iterator itr = objects.begin(); itr != objects.end() - 1;) {
@@ -229,6 +236,8 @@ fs::path cLevel_Manager::Get_Path(const std::string& levelname, bool check_only_
 
 void cLevel_Manager::Update(void)
 {
+    pDispatch_Benchmark->Update();
+
     // input
     pActive_Level->Process_Input();
 
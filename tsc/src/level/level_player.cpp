@@ -2248,7 +2248,7 @@ void cLevel_Player::Draw(cSurface_Request* request /* = NULL */)
             // if on ground
             if (m_ground_object) {
                 // create request
-                cRect_Request* rect_request = new cRect_Request();
+                cRect_Request* rect_request = pRenderer->Alloc<cRect_Request>();
                 // draw
                 pVideo->Draw_Rect(&m_ground_object->m_col_rect, m_pos_z + 0.000009f, &grey, rect_request);
                 rect_request->m_no_camera = 0;
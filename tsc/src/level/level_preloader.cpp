@@ -0,0 +1,383 @@
+/***************************************************************************
+ * level_preloader.cpp - reads levels in the background
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "level_preloader.hpp"
+#include "level_loader.hpp"
+#include "level_manager.hpp"
+#include "level.hpp"
+#include "../core/game_core.hpp"
+#include "../core/sprite_manager.hpp"
+#include "../core/camera.hpp"
+#include "../core/filesystem/filesystem.hpp"
+#include "../core/property_helper.hpp"
+#include "../objects/level_exit.hpp"
+#include "../overworld/overworld.hpp"
+#include "../overworld/world_player.hpp"
+#include "../overworld/world_waypoint.hpp"
+#include "../video/video.hpp"
+
+namespace fs = boost::filesystem;
+
+using namespace std;
+
+namespace TSC {
+
+/* *** *** *** *** *** *** *** cLevel_Preloader *** *** *** *** *** *** *** *** *** *** */
+
+// preloaded levels kept at most
+static const size_t level_preload_max_entries = 4;
+// frames between checking the level exits
+static const unsigned int level_preload_check_frames = 15;
+// distance around the screen to look for level exits
+static const float level_preload_exit_distance = 800.0f;
+// time for loading images every frame in microseconds
+static const int64_t level_preload_image_budget = 2000;
+
+// Return the modification time of the file or 0
+static std::time_t Get_Write_Time(const fs::path& filename)
+{
+    boost::system::error_code error;
+    const std::time_t write_time = fs::last_write_time(filename, error);
+
+    return error ? 0 : write_time;
+}
+
+cLevel_Preloader::cLevel_Preloader(void)
+{
+    m_exit = 0;
+    m_check_counter = 0;
+    mp_checked_level = NULL;
+    mp_checked_overworld = NULL;
+    m_checked_waypoint = -1;
+
+    mp_thread = new boost::thread(&cLevel_Preloader::Worker, this);
+}
+
+cLevel_Preloader::~cLevel_Preloader(void)
+{
+    {
+        boost::lock_guard<boost::mutex> lock(m_mutex);
+        m_exit = 1;
+    }
+    m_wake.notify_all();
+
+    mp_thread->join();
+    delete mp_thread;
+
+    for (vector<Preload_Entry*>::iterator itr = m_entries.begin(); itr != m_entries.end(); ++itr) {
+        delete *itr;
+    }
+}
+
+void cLevel_Preloader::Preload(const fs::path& filename)
+{
+    // only the current level formats
+    if (filename.empty() || (filename.extension() != fs::path(".tsclvl") && filename.extension() != fs::path(".smclvl"))) {
+        return;
+    }
+
+    {
+        boost::lock_guard<boost::mutex> lock(m_mutex);
+
+        for (vector<Preload_Entry*>::iterator itr = m_entries.begin(); itr != m_entries.end(); ++itr) {
+            // already known
+            if ((*itr)->m_filename == filename && !(*itr)->m_discard) {
+                return;
+            }
+        }
+
+        // drop the oldest entry not read currently
+        if (m_entries.size() >= level_preload_max_entries) {
+            for (vector<Preload_Entry*>::iterator itr = m_entries.begin(); itr != m_entries.end(); ++itr) {
+                if ((*itr)->m_state != PRELOAD_READING) {
+                    Remove(itr);
+                    break;
+                }
+            }
+        }
+
+        Preload_Entry* entry = new Preload_Entry();
+        entry->m_filename = filename;
+        entry->m_write_time = Get_Write_Time(filename);
+        entry->m_state = PRELOAD_WAITING;
+        entry->m_discard = 0;
+        entry->m_image_record = 0;
+        m_entries.push_back(entry);
+    }
+
+    m_wake.notify_all();
+}
+
+bool cLevel_Preloader::Take(const fs::path& filename, cLevel_Cache& cache)
+{
+    boost::unique_lock<boost::mutex> lock(m_mutex);
+
+    vector<Preload_Entry*>::iterator itr = m_entries.begin();
+
+    for (; itr != m_entries.end(); ++itr) {
+        if ((*itr)->m_filename == filename && !(*itr)->m_discard) {
+            break;
+        }
+    }
+
+    if (itr == m_entries.end()) {
+        return 0;
+    }
+
+    Preload_Entry* entry = *itr;
+
+    // not started, the caller parses it faster itself
+    if (entry->m_state == PRELOAD_WAITING) {
+        Remove(itr);
+        return 0;
+    }
+
+    while (entry->m_state == PRELOAD_READING) {
+        m_done.wait(lock);
+    }
+
+    // the list may have changed while waiting
+    itr = std::find(m_entries.begin(), m_entries.end(), entry);
+
+    const bool valid = entry->m_state == PRELOAD_DONE && entry->m_write_time == Get_Write_Time(filename);
+
+    if (valid) {
+        cache.Swap(entry->m_cache);
+    }
+
+    Remove(itr);
+    return valid;
+}
+
+void cLevel_Preloader::Clear(void)
+{
+    boost::lock_guard<boost::mutex> lock(m_mutex);
+
+    while (!m_entries.empty()) {
+        vector<Preload_Entry*>::iterator itr = m_entries.begin();
+
+        // skip the entry being read
+        while (itr != m_entries.end() && (*itr)->m_state == PRELOAD_READING) {
+            (*itr)->m_discard = 1;
+            ++itr;
+        }
+
+        if (itr == m_entries.end()) {
+            break;
+        }
+
+        Remove(itr);
+    }
+
+    m_checked_levels.clear();
+    mp_checked_level = NULL;
+    mp_checked_overworld = NULL;
+    m_checked_waypoint = -1;
+}
+
+void cLevel_Preloader::Remove(vector<Preload_Entry*>::iterator itr)
+{
+    // the worker deletes it when done
+    if ((*itr)->m_state == PRELOAD_READING) {
+        (*itr)->m_discard = 1;
+        return;
+    }
+
+    delete *itr;
+    m_entries.erase(itr);
+}
+
+void cLevel_Preloader::Worker(void)
+{
+    while (1) {
+        Preload_Entry* entry = NULL;
+        fs::path filename;
+
+        {
+            boost::unique_lock<boost::mutex> lock(m_mutex);
+
+            while (!m_exit && !entry) {
+                for (vector<Preload_Entry*>::iterator itr = m_entries.begin(); itr != m_entries.end(); ++itr) {
+                    if ((*itr)->m_state == PRELOAD_WAITING) {
+                        entry = *itr;
+                        break;
+                    }
+                }
+
+                if (!entry) {
+                    m_wake.wait(lock);
+                }
+            }
+
+            if (m_exit) {
+                return;
+            }
+
+            entry->m_state = PRELOAD_READING;
+            filename = entry->m_filename;
+        }
+
+        cLevel_Cache cache;
+        Preload_State state = PRELOAD_DONE;
+
+        try {
+            cLevelLoader::Preload_File(filename, cache);
+        }
+        catch (...) {
+            // loading it again on the main thread shows the error
+            state = PRELOAD_FAILED;
+        }
+
+        {
+            boost::lock_guard<boost::mutex> lock(m_mutex);
+
+            entry->m_state = state;
+            entry->m_cache.Swap(cache);
+
+            if (entry->m_discard) {
+                Remove(std::find(m_entries.begin(), m_entries.end(), entry));
+            }
+        }
+        m_done.notify_all();
+    }
+}
+
+void cLevel_Preloader::Update(void)
+{
+    if (Game_Mode == MODE_LEVEL && !editor_enabled) {
+        Check_Level_Exits();
+    }
+    else if (Game_Mode == MODE_OVERWORLD && !editor_world_enabled) {
+        Check_Waypoint();
+    }
+
+    Load_Images();
+}
+
+void cLevel_Preloader::Check_Level_Exits(void)
+{
+    if (m_check_counter) {
+        m_check_counter--;
+        return;
+    }
+
+    m_check_counter = level_preload_check_frames;
+
+    if (mp_checked_level != pActive_Level) {
+        mp_checked_level = pActive_Level;
+        m_checked_levels.clear();
+    }
+
+    GL_rect rect = pActive_Camera->Get_Rect();
+    rect.m_x -= level_preload_exit_distance;
+    rect.m_y -= level_preload_exit_distance;
+    rect.m_w += level_preload_exit_distance * 2.0f;
+    rect.m_h += level_preload_exit_distance * 2.0f;
+
+    cSprite_List objects;
+    pActive_Level->m_sprite_manager->Get_Colliding_Objects(objects, rect);
+
+    for (cSprite_List::iterator itr = objects.begin(); itr != objects.end(); ++itr) {
+        if ((*itr)->m_type != TYPE_LEVEL_EXIT) {
+            continue;
+        }
+
+        cLevel_Exit* level_exit = static_cast<cLevel_Exit*>(*itr);
+
+        // same level
+        if (level_exit->m_dest_level.empty() || level_exit->m_dest_level == pActive_Level->Get_Level_Name()) {
+            continue;
+        }
+        // already handled
+        if (!m_checked_levels.insert(level_exit->m_dest_level).second) {
+            continue;
+        }
+        // already loaded
+        if (pLevel_Manager->Get(level_exit->m_dest_level)) {
+            continue;
+        }
+
+        Preload(pLevel_Manager->Get_Path(level_exit->m_dest_level));
+    }
+}
+
+void cLevel_Preloader::Check_Waypoint(void)
+{
+    if (!pActive_Overworld || !pOverworld_Player) {
+        return;
+    }
+
+    if (mp_checked_overworld == pActive_Overworld && m_checked_waypoint == pOverworld_Player->m_current_waypoint) {
+        return;
+    }
+
+    mp_checked_overworld = pActive_Overworld;
+    m_checked_waypoint = pOverworld_Player->m_current_waypoint;
+
+    cWaypoint* waypoint = pOverworld_Player->Get_Waypoint();
+
+    if (!waypoint || waypoint->m_waypoint_type != WAYPOINT_NORMAL || waypoint->Get_Destination().empty()) {
+        return;
+    }
+
+    Preload(waypoint->Get_Destination_Path());
+}
+
+void cLevel_Preloader::Load_Images(void)
+{
+    boost::lock_guard<boost::mutex> lock(m_mutex);
+
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    for (vector<Preload_Entry*>::iterator itr = m_entries.begin(); itr != m_entries.end(); ++itr) {
+        Preload_Entry* entry = *itr;
+
+        if (entry->m_state != PRELOAD_DONE) {
+            continue;
+        }
+
+        const vector<cLevel_Cache::Record>& records = entry->m_cache.m_records;
+
+        while (entry->m_image_record < records.size()) {
+            const cLevel_Cache::Record& record = records[entry->m_image_record];
+            entry->m_image_record++;
+
+            if (record.m_type != LEVEL_CACHE_PROPERTY) {
+                continue;
+            }
+
+            const std::string& value = entry->m_cache.Get_String(record.m_second);
+
+            if (value.size() < 5 || (value.compare(value.size() - 4, 4, ".png") != 0 && (value.size() < 10 || value.compare(value.size() - 9, 9, ".settings") != 0))) {
+                continue;
+            }
+
+            // loaded and kept by the image manager
+            pVideo->Get_Surface(utf8_to_path(value), 0);
+
+            if (std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count() >= level_preload_image_budget) {
+                return;
+            }
+        }
+    }
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+cLevel_Preloader* pLevel_Preloader = NULL;
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
@@ -0,0 +1,122 @@
+/***************************************************************************
+ * level_preloader.hpp - reads levels in the background
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TSC_LEVEL_PRELOADER_HPP
+#define TSC_LEVEL_PRELOADER_HPP
+
+#include "../core/global_game.hpp"
+#include "level_cache.hpp"
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
+
+namespace TSC {
+
+    /* *** *** *** *** *** *** *** cLevel_Preloader *** *** *** *** *** *** *** *** *** *** */
+
+    /* Reads levels the player will likely enter next on a worker thread
+     * The level file is parsed into a cLevel_Cache while the game keeps
+     * running. cLevel::Load_From_File takes the result and only creates
+     * the objects. The sprites and their textures are still created on the
+     * main thread as OpenGL and the managers can only be used there, but
+     * the images named in a preloaded level are loaded in small slices
+     * every frame before.
+     * Levels are preloaded for the level exits near the camera and for
+     * the overworld waypoint the player is on.
+    */
+    class cLevel_Preloader {
+    public:
+        cLevel_Preloader(void);
+        ~cLevel_Preloader(void);
+
+        // Start reading the given level file if not already done
+        void Preload(const boost::filesystem::path& filename);
+        /* Take the preloaded data of the given level file
+         * Waits if the file is still read.
+         * returns false if the file was not preloaded, failed to read or
+         * changed since
+        */
+        bool Take(const boost::filesystem::path& filename, cLevel_Cache& cache);
+        // Forget all preloaded levels
+        void Clear(void);
+
+        /* Check for levels to preload and load images of the preloaded levels
+         * must be called once every frame from the main thread
+        */
+        void Update(void);
+
+    private:
+        enum Preload_State {
+            PRELOAD_WAITING,
+            PRELOAD_READING,
+            PRELOAD_DONE,
+            PRELOAD_FAILED
+        };
+
+        struct Preload_Entry {
+            boost::filesystem::path m_filename;
+            // modification time when reading started
+            std::time_t m_write_time;
+            Preload_State m_state;
+            // delete when reading is done
+            bool m_discard;
+            cLevel_Cache m_cache;
+            // next record to check for images
+            size_t m_image_record;
+        };
+
+        // Worker thread main loop
+        void Worker(void);
+        // Delete the entry if it is not read currently, requires m_mutex
+        void Remove(std::vector<Preload_Entry*>::iterator itr);
+
+        // Preload the destination levels of the level exits near the camera
+        void Check_Level_Exits(void);
+        // Preload the level of the current overworld waypoint
+        void Check_Waypoint(void);
+        // Load the images of the preloaded levels within the time budget
+        void Load_Images(void);
+
+        boost::thread* mp_thread;
+        // protects the fields below
+        boost::mutex m_mutex;
+        // signaled when an entry is added or on exit
+        boost::condition_variable m_wake;
+        // signaled when an entry is read
+        boost::condition_variable m_done;
+        // oldest first
+        std::vector<Preload_Entry*> m_entries;
+        bool m_exit;
+
+        // frames until the level exits are checked again
+        unsigned int m_check_counter;
+        // level of which the exits were checked
+        cLevel* mp_checked_level;
+        // destination levels already handled for that level
+        std::set<std::string> m_checked_levels;
+        // overworld and waypoint handled last
+        cOverworld* mp_checked_overworld;
+        int m_checked_waypoint;
+    };
+
+    /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+// Level Preloader
+    extern cLevel_Preloader* pLevel_Preloader;
+
+    /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
+
+#endif
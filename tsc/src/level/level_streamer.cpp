@@ -0,0 +1,339 @@
+/***************************************************************************
+ * level_streamer.cpp - creates level objects near the camera only
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "level_streamer.hpp"
+#include "level_loader.hpp"
+#include "../core/sprite_manager.hpp"
+#include "../core/property_helper.hpp"
+#include "../core/game_core.hpp"
+#include <cctype>
+
+using namespace std;
+
+namespace TSC {
+
+/* *** *** *** *** *** *** *** cLevel_Streamer *** *** *** *** *** *** *** *** *** *** */
+
+// chunk width and height
+static const float level_stream_chunk_size = 1024.0f;
+/* chunks at least this near to the given rect are created
+ * the activity wake distance plus one chunk is used if bigger
+*/
+static const float level_stream_load_distance = 1024.0f;
+// chunks this much further away than the load distance are deleted
+static const float level_stream_unload_border = 1536.0f;
+// smaller levels are created at once
+static const size_t level_stream_min_objects = 2000;
+
+cLevel_Streamer::cLevel_Streamer(cSprite_Manager* sprite_manager)
+{
+    m_sprite_manager = sprite_manager;
+    m_engine_version = 0;
+    m_object_count = 0;
+}
+
+cLevel_Streamer::~cLevel_Streamer(void)
+{
+    // the created sprites belong to the sprite manager
+}
+
+bool cLevel_Streamer::Is_Streamable(const std::string& name)
+{
+    return name == "sprite";
+}
+
+void cLevel_Streamer::Add(const std::string& name, const XmlAttributes& attributes, int engine_version)
+{
+    // not set if the level has no information
+    m_engine_version = max(engine_version, 0);
+
+    float pos_x = attributes.fetch<float>("posx", 0.0f);
+    float pos_y = attributes.fetch<float>("posy", 0.0f);
+
+    // see Create_Sprites_From_XML_Tag
+    if (m_engine_version < 35) {
+        pos_y -= 600.0f;
+    }
+
+    const std::pair<int, int> key(static_cast<int>(floor(pos_x / level_stream_chunk_size)), static_cast<int>(floor(pos_y / level_stream_chunk_size)));
+
+    Stream_Object obj(name, attributes);
+    obj.m_uid = attributes.fetch<int>("uid", -1);
+
+    // not given to new objects meanwhile
+    if (obj.m_uid > 0) {
+        m_sprite_manager->Reserve_UID(obj.m_uid);
+    }
+
+    m_chunks[key].m_objects.push_back(obj);
+    m_object_count++;
+}
+
+bool cLevel_Streamer::Finish_Loading(const std::string& script)
+{
+    if (m_object_count < level_stream_min_objects) {
+        Load_All();
+        return 0;
+    }
+
+    // all numbers in the script could be UIDs
+    std::set<int> script_numbers;
+
+    for (std::string::size_type pos = 0; pos < script.size();) {
+        if (!isdigit(static_cast<unsigned char>(script[pos]))) {
+            pos++;
+            continue;
+        }
+
+        const std::string::size_type start = pos;
+
+        while (pos < script.size() && isdigit(static_cast<unsigned char>(script[pos]))) {
+            pos++;
+        }
+
+        // longer numbers are no valid UID
+        if (pos - start <= 9) {
+            script_numbers.insert(string_to_int(script.substr(start, pos - start)));
+        }
+    }
+
+    // create them now and forget them
+    for (Chunk_Map::iterator itr = m_chunks.begin(); itr != m_chunks.end(); ++itr) {
+        std::vector<Stream_Object>& objects = itr->second.m_objects;
+
+        for (std::vector<Stream_Object>::iterator obj_itr = objects.begin(); obj_itr != objects.end();) {
+            if (obj_itr->m_uid > 0 && script_numbers.count(obj_itr->m_uid)) {
+                Create(*obj_itr);
+                obj_itr = objects.erase(obj_itr);
+                m_object_count--;
+            }
+            else {
+                ++obj_itr;
+            }
+        }
+    }
+
+    debug_print("Streaming %u level objects in %u chunks\n", static_cast<unsigned int>(m_object_count), static_cast<unsigned int>(m_chunks.size()));
+
+    return m_object_count > 0;
+}
+
+void cLevel_Streamer::Update(const GL_rect& rect)
+{
+    /* a sprite is only updated within the wake distance of the camera center
+     * so everything it can stand on is created before it wakes up
+     * the extra chunk covers sprites starting in the chunk before
+    */
+    const float load_distance = max(level_stream_load_distance, m_sprite_manager->m_activity_regions.Get_Wake_Distance() + level_stream_chunk_size);
+    const float unload_distance = load_distance + level_stream_unload_border;
+    const GL_rect load_rect(rect.m_x - load_distance, rect.m_y - load_distance, rect.m_w + load_distance * 2.0f, rect.m_h + load_distance * 2.0f);
+    const GL_rect unload_rect(rect.m_x - unload_distance, rect.m_y - unload_distance, rect.m_w + unload_distance * 2.0f, rect.m_h + unload_distance * 2.0f);
+    bool changed = 0;
+    std::vector<Chunk*> unload_chunks;
+
+    for (Chunk_Map::iterator itr = m_chunks.begin(); itr != m_chunks.end(); ++itr) {
+        Chunk& chunk = itr->second;
+        const GL_rect chunk_rect(itr->first.first * level_stream_chunk_size, itr->first.second * level_stream_chunk_size, level_stream_chunk_size, level_stream_chunk_size);
+
+        if (!chunk.m_loaded && load_rect.Intersects(chunk_rect)) {
+            Load_Chunk(chunk);
+            changed = 1;
+        }
+        else if (chunk.m_loaded && !unload_rect.Intersects(chunk_rect)) {
+            unload_chunks.push_back(&chunk);
+        }
+    }
+
+    if (!unload_chunks.empty()) {
+        std::set<cSprite*> sprites;
+
+        for (std::vector<Chunk*>::iterator itr = unload_chunks.begin(); itr != unload_chunks.end(); ++itr) {
+            for (std::vector<Stream_Object>::iterator obj_itr = (*itr)->m_objects.begin(); obj_itr != (*itr)->m_objects.end(); ++obj_itr) {
+                sprites.insert(obj_itr->m_sprites.begin(), obj_itr->m_sprites.end());
+            }
+        }
+
+        // no ground object may point to a deleted sprite
+        Reset_Ground_Objects(sprites);
+
+        for (std::vector<Chunk*>::iterator itr = unload_chunks.begin(); itr != unload_chunks.end(); ++itr) {
+            Unload_Chunk(**itr);
+        }
+
+        changed = 1;
+    }
+
+    // the created sprites are immobile
+    if (changed) {
+        m_sprite_manager->Build_Static_Collision();
+    }
+}
+
+void cLevel_Streamer::Load_All(void)
+{
+    for (Chunk_Map::iterator itr = m_chunks.begin(); itr != m_chunks.end(); ++itr) {
+        if (!itr->second.m_loaded) {
+            Load_Chunk(itr->second);
+        }
+    }
+
+    // the sprites are now normal level objects
+    m_chunks.clear();
+    m_object_count = 0;
+
+    m_sprite_manager->Build_Static_Collision();
+}
+
+void cLevel_Streamer::Create(Stream_Object& obj)
+{
+    // the loader may change the properties for old levels
+    XmlAttributes attributes = obj.m_attributes;
+    obj.m_sprites = cLevelLoader::Create_Level_Objects_From_XML_Tag(obj.m_name, attributes, m_engine_version, m_sprite_manager);
+
+    if (obj.m_sprites.empty()) {
+        return;
+    }
+
+    // keep the UID the first sprite got when created again
+    if (obj.m_uid > 0) {
+        obj.m_sprites[0]->m_uid = obj.m_uid;
+    }
+
+    const bool created_before = !obj.m_pos_z.empty();
+
+    for (size_t i = 0; i < obj.m_sprites.size(); i++) {
+        cSprite* sprite = obj.m_sprites[i];
+
+        if (created_before && i < obj.m_pos_z.size()) {
+            /* Add gives it a new z position above all others of its massivity
+             * keep the old one and do not raise the massivity z positions
+             * as they would grow with every reload
+            */
+            const float z_pos_data = m_sprite_manager->m_z_pos_data[sprite->m_massive_type];
+            const float z_pos_data_editor = m_sprite_manager->m_z_pos_data_editor[sprite->m_massive_type];
+
+            m_sprite_manager->Add(sprite);
+
+            m_sprite_manager->m_z_pos_data[sprite->m_massive_type] = z_pos_data;
+            m_sprite_manager->m_z_pos_data_editor[sprite->m_massive_type] = z_pos_data_editor;
+            sprite->m_pos_z = obj.m_pos_z[i];
+            sprite->m_editor_pos_z = obj.m_editor_pos_z[i];
+        }
+        else {
+            m_sprite_manager->Add(sprite);
+
+            obj.m_pos_z.push_back(sprite->m_pos_z);
+            obj.m_editor_pos_z.push_back(sprite->m_editor_pos_z);
+        }
+
+        sprite->Init_Links();
+    }
+
+    obj.m_sprite_uids.clear();
+
+    for (std::vector<cSprite*>::iterator itr = obj.m_sprites.begin(); itr != obj.m_sprites.end(); ++itr) {
+        obj.m_sprite_uids.push_back((*itr)->m_uid);
+    }
+
+    obj.m_uid = obj.m_sprites[0]->m_uid;
+}
+
+void cLevel_Streamer::Load_Chunk(Chunk& chunk)
+{
+    for (std::vector<Stream_Object>::iterator itr = chunk.m_objects.begin(); itr != chunk.m_objects.end(); ++itr) {
+        Create(*itr);
+    }
+
+    chunk.m_loaded = 1;
+}
+
+void cLevel_Streamer::Unload_Chunk(Chunk& chunk)
+{
+    for (std::vector<Stream_Object>::iterator itr = chunk.m_objects.begin(); itr != chunk.m_objects.end();) {
+        Stream_Object& obj = *itr;
+        bool destroyed = obj.m_sprites.empty();
+
+        for (size_t i = 0; i < obj.m_sprites.size(); i++) {
+            cSprite* sprite = obj.m_sprites[i];
+
+            // left to the sprite manager
+            if (Is_Destroyed(sprite, obj.m_sprite_uids[i])) {
+                destroyed = 1;
+                continue;
+            }
+
+            m_sprite_manager->Delete(sprite);
+        }
+
+        obj.m_sprites.clear();
+        obj.m_sprite_uids.clear();
+
+        // do not bring it back
+        if (destroyed) {
+            itr = chunk.m_objects.erase(itr);
+            m_object_count--;
+        }
+        else {
+            ++itr;
+        }
+    }
+
+    chunk.m_loaded = 0;
+}
+
+bool cLevel_Streamer::Is_Destroyed(cSprite* sprite, int uid) const
+{
+    // the UID index only holds sprites still in the array
+    if (m_sprite_manager->Get_by_UID(uid) == sprite) {
+        return sprite->m_auto_destroy;
+    }
+
+    /* the UID may be shadowed by another sprite of an old level with the same UID
+     * only compare the pointers as a replaced sprite is deleted
+    */
+    if (std::find(m_sprite_manager->objects.begin(), m_sprite_manager->objects.end(), sprite) == m_sprite_manager->objects.end()) {
+        return 1;
+    }
+
+    // a new sprite at the address of a replaced one
+    if (sprite->m_uid != uid) {
+        return 1;
+    }
+
+    return sprite->m_auto_destroy;
+}
+
+void cLevel_Streamer::Reset_Ground_Objects(const std::set<cSprite*>& sprites)
+{
+    // sleeping objects far away from the camera may still stand on them
+    for (cSprite_List::iterator itr = m_sprite_manager->objects.begin(); itr != m_sprite_manager->objects.end(); ++itr) {
+        cMovingSprite* moving_sprite = dynamic_cast<cMovingSprite*>(*itr);
+
+        if (moving_sprite && moving_sprite->m_ground_object && sprites.count(moving_sprite->m_ground_object)) {
+            moving_sprite->Reset_On_Ground();
+        }
+    }
+
+    // the player is not in the array
+    cMovingSprite* player = dynamic_cast<cMovingSprite*>(pActive_Player);
+
+    if (player && player->m_ground_object && sprites.count(player->m_ground_object)) {
+        player->Reset_On_Ground();
+    }
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
@@ -0,0 +1,118 @@
+/***************************************************************************
+ * level_streamer.hpp - creates level objects near the camera only
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TSC_LEVEL_STREAMER_HPP
+#define TSC_LEVEL_STREAMER_HPP
+
+#include "../core/global_game.hpp"
+#include "../core/xml_attributes.hpp"
+#include "../core/math/rect.hpp"
+
+namespace TSC {
+
+    /* *** *** *** *** *** *** *** cLevel_Streamer *** *** *** *** *** *** *** *** *** *** */
+
+    /* Keeps the static sprites of a big level serialized until needed
+     * The loader hands the <sprite> elements to the streamer instead of
+     * creating them. They are sorted into square chunks by their position
+     * and kept as their element properties. The chunks near the camera are
+     * created and the chunks far away are deleted again. Only plain sprites
+     * are streamed as they have no state to lose, all other objects and the
+     * sprites with a UID found in the level script are always created.
+     * The UIDs of the serialized sprites stay reserved.
+    */
+    class cLevel_Streamer {
+    public:
+        cLevel_Streamer(cSprite_Manager* sprite_manager);
+        ~cLevel_Streamer(void);
+
+        // Return true if the objects of the element can be streamed
+        static bool Is_Streamable(const std::string& name);
+
+        // Keep the element serialized in the chunk of its position
+        void Add(const std::string& name, const XmlAttributes& attributes, int engine_version);
+        /* Called when the level is parsed
+         * Creates the sprites with a UID used in the script. If the level
+         * is small all sprites are created.
+         * returns false if nothing is left to stream
+        */
+        bool Finish_Loading(const std::string& script);
+
+        /* Create the chunks near the rect and delete the chunks far from it
+         * the chunks within the activity wake distance are always created
+        */
+        void Update(const GL_rect& rect);
+        // Create all sprites and stop streaming
+        void Load_All(void);
+
+        // Return the number of serialized and created chunks
+        inline size_t Get_Chunk_Count(void) const
+        {
+            return m_chunks.size();
+        }
+
+    private:
+        struct Stream_Object {
+            Stream_Object(const std::string& name, const XmlAttributes& attributes)
+                : m_name(name), m_attributes(attributes), m_uid(-1) {}
+
+            std::string m_name;
+            XmlAttributes m_attributes;
+            // from the level or given when first created
+            int m_uid;
+            // created sprites, usually one
+            std::vector<cSprite*> m_sprites;
+            // UIDs of the created sprites
+            std::vector<int> m_sprite_uids;
+            // z positions of the sprites when first created
+            std::vector<float> m_pos_z;
+            std::vector<float> m_editor_pos_z;
+        };
+
+        struct Chunk {
+            Chunk(void)
+                : m_loaded(0) {}
+
+            std::vector<Stream_Object> m_objects;
+            bool m_loaded;
+        };
+
+        typedef std::map<std::pair<int, int>, Chunk> Chunk_Map;
+
+        // Create the sprites of the object
+        void Create(Stream_Object& obj);
+        // Create all sprites of the chunk
+        void Load_Chunk(Chunk& chunk);
+        // Delete all sprites of the chunk and forget the destroyed ones
+        void Unload_Chunk(Chunk& chunk);
+        /* Return true if the created sprite was destroyed or replaced by another
+         * a replaced sprite is already deleted and is not accessed
+        */
+        bool Is_Destroyed(cSprite* sprite, int uid) const;
+        // Let the objects standing on the given sprites search their ground again
+        void Reset_Ground_Objects(const std::set<cSprite*>& sprites);
+
+        cSprite_Manager* m_sprite_manager;
+        Chunk_Map m_chunks;
+        int m_engine_version;
+        // serialized objects
+        size_t m_object_count;
+    };
+
+    /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
+
+#endif
@@ -77,6 +77,8 @@ void cBall::Init(void)
 
     Set_Spawned(1);
     m_camera_range = 2000;
+    // destroys itself if out of range
+    m_always_active = 1;
 
     m_massive_type = MASS_MASSIVE;
 
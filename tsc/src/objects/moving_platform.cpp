@@ -116,6 +116,8 @@ void cMoving_Platform::Init(void)
     m_can_be_on_ground = 0;
 
     m_camera_range = 3000;
+    // keeps its path position in sync
+    m_always_active = 1;
     m_can_be_ground = 1;
 
     m_move_type = MOVING_PLATFORM_TYPE_LINE;
@@ -686,7 +688,7 @@ void cMoving_Platform::Draw(cSurface_Request* request /* = NULL */)
         m_start_image = m_image;
         // create request
 
-        surface_request = new cSurface_Request();
+        surface_request = pRenderer->Alloc<cSurface_Request>();
         // draw only first image complete
         cMovingSprite::Draw(surface_request);
         surface_request->m_pos_x += x;
@@ -702,7 +704,7 @@ void cMoving_Platform::Draw(cSurface_Request* request /* = NULL */)
         m_start_image = m_image;
         for (unsigned int i = 0; i < m_middle_count; i++) {
             // create request
-            surface_request = new cSurface_Request();
+            surface_request = pRenderer->Alloc<cSurface_Request>();
             cMovingSprite::Draw_Image(surface_request);
             surface_request->m_pos_x += x;
             x += m_middle_image.m_image->m_w;
@@ -717,7 +719,7 @@ void cMoving_Platform::Draw(cSurface_Request* request /* = NULL */)
         m_image = m_right_image.m_image;
         m_start_image = m_image;
         // create request
-        surface_request = new cSurface_Request();
+        surface_request = pRenderer->Alloc<cSurface_Request>();
         cMovingSprite::Draw_Image(surface_request);
         surface_request->m_pos_x += x;
         //x += m_images[2]->w;
@@ -748,7 +750,7 @@ void cMoving_Platform::Draw(cSurface_Request* request /* = NULL */)
         }
         else if (m_move_type == MOVING_PLATFORM_TYPE_CIRCLE) {
             // circle
-            cCircle_Request* circle_request = new cCircle_Request();
+            cCircle_Request* circle_request = pRenderer->Alloc<cCircle_Request>();
             pVideo->Draw_Circle(m_start_pos_x - pActive_Camera->m_x, m_start_pos_y - m_max_distance - pActive_Camera->m_y, static_cast<float>(m_max_distance), m_pos_z - 0.0001f, &m_editor_color, circle_request);
             circle_request->m_line_width = 2;
             // add request
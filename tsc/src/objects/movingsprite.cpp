@@ -228,15 +228,15 @@ void cMovingSprite::Move(float move_x, float move_y, bool real /* = 0 */)
     Check_And_Handle_Out_Of_Level(move_x, move_y);
 }
 
-cObjectCollisionType* cMovingSprite::Col_Move_in_Steps(float move_x, float move_y, float step_size_x, float step_size_y, float final_pos_x, float final_pos_y, cSprite_List sprite_list, bool stop_on_internal /* = 0 */)
+void cMovingSprite::Col_Move_in_Steps(cObjectCollisionType& col_list, float move_x, float move_y, float step_size_x, float step_size_y, float final_pos_x, float final_pos_y, cSprite_List& sprite_list, bool stop_on_internal /* = 0 */)
 {
     if (sprite_list.empty()) {
         cSprite::Move(final_pos_x - m_pos_x, final_pos_y - m_pos_y, 1);
-        return NULL;
+        return;
     }
 
-    // collision list
-    cObjectCollisionType* col_list = new cObjectCollisionType();
+    // single step collisions
+    cObjectCollisionType& col_list_temp = m_col_check_list;
 
     bool move_x_valid = 1;
     bool move_y_valid = 1;
@@ -253,24 +253,24 @@ cObjectCollisionType* cMovingSprite::Col_Move_in_Steps(float move_x, float move_
             }
 
             // collision check
-            cObjectCollisionType* col_list_temp = Collision_Check_Relative(step_size_x, 0.0f, 0.0f, 0.0f, COLLIDE_COMPLETE, &sprite_list);
+            Collision_Check_Relative(col_list_temp, step_size_x, 0.0f, 0.0f, 0.0f, COLLIDE_COMPLETE, &sprite_list);
 
             bool collision_found = 0;
 
             // stop on everything
             if (stop_on_internal) {
-                if (col_list_temp->size()) {
+                if (col_list_temp.size()) {
                     collision_found = 1;
                 }
             }
             // stop only on blocking
             else {
-                if (col_list_temp->Is_Included(COL_VTYPE_BLOCKING)) {
+                if (col_list_temp.Is_Included(COL_VTYPE_BLOCKING)) {
                     collision_found = 1;
                 }
                 // remove internal collision from further checks
-                else if (col_list_temp->objects.size()) {
-                    for (cObjectCollision_List::iterator itr = col_list_temp->objects.begin(); itr != col_list_temp->objects.end(); ++itr) {
+                else if (col_list_temp.objects.size()) {
+                    for (cObjectCollision_List::iterator itr = col_list_temp.objects.begin(); itr != col_list_temp.objects.end(); ++itr) {
                         cObjectCollision* col = (*itr);
 
                         if (col->m_valid_type != COL_VTYPE_INTERNAL) {
@@ -296,13 +296,11 @@ cObjectCollisionType* cMovingSprite::Col_Move_in_Steps(float move_x, float move_
                 }
             }
 
-            if (col_list_temp->size()) {
-                col_list->objects.insert(col_list->objects.end(), col_list_temp->objects.begin(), col_list_temp->objects.end());
-                col_list_temp->objects.clear();
+            if (col_list_temp.size()) {
+                col_list.objects.insert(col_list.objects.end(), col_list_temp.objects.begin(), col_list_temp.objects.end());
+                col_list_temp.objects.clear();
             }
 
-            delete col_list_temp;
-
             if (!collision_found) {
                 m_pos_x += step_size_x;
 
@@ -330,24 +328,24 @@ cObjectCollisionType* cMovingSprite::Col_Move_in_Steps(float move_x, float move_
             }
 
             // collision check
-            cObjectCollisionType* col_list_temp = Collision_Check_Relative(0.0f, step_size_y, 0.0f, 0.0f, COLLIDE_COMPLETE, &sprite_list);
+            Collision_Check_Relative(col_list_temp, 0.0f, step_size_y, 0.0f, 0.0f, COLLIDE_COMPLETE, &sprite_list);
 
             bool collision_found = 0;
 
             // stop on everything
             if (stop_on_internal) {
-                if (col_list_temp->size()) {
+                if (col_list_temp.size()) {
                     collision_found = 1;
                 }
             }
             // stop only on blocking
             else {
-                if (col_list_temp->Is_Included(COL_VTYPE_BLOCKING)) {
+                if (col_list_temp.Is_Included(COL_VTYPE_BLOCKING)) {
                     collision_found = 1;
                 }
                 // remove internal collision from further checks
-                else if (col_list_temp->objects.size()) {
-                    for (cObjectCollision_List::iterator itr = col_list_temp->objects.begin(); itr != col_list_temp->objects.end(); ++itr) {
+                else if (col_list_temp.objects.size()) {
+                    for (cObjectCollision_List::iterator itr = col_list_temp.objects.begin(); itr != col_list_temp.objects.end(); ++itr) {
                         cObjectCollision* col = (*itr);
 
                         if (col->m_valid_type != COL_VTYPE_INTERNAL) {
@@ -373,13 +371,11 @@ cObjectCollisionType* cMovingSprite::Col_Move_in_Steps(float move_x, float move_
                 }
             }
 
-            if (col_list_temp->size()) {
-                col_list->objects.insert(col_list->objects.end(), col_list_temp->objects.begin(), col_list_temp->objects.end());
-                col_list_temp->objects.clear();
+            if (col_list_temp.size()) {
+                col_list.objects.insert(col_list.objects.end(), col_list_temp.objects.begin(), col_list_temp.objects.end());
+                col_list_temp.objects.clear();
             }
 
-            delete col_list_temp;
-
             if (!collision_found) {
                 m_pos_y += step_size_y;
 
@@ -399,8 +395,169 @@ cObjectCollisionType* cMovingSprite::Col_Move_in_Steps(float move_x, float move_
             }
         }
     }
+}
 
-    return col_list;
+void cMovingSprite::Col_Move_Swept(cObjectCollisionType& col_list, float move_x, float move_y, cSprite_List& sprite_list)
+{
+    if (sprite_list.empty()) {
+        cSprite::Move(move_x, move_y, 1);
+        return;
+    }
+
+    Col_Move_Swept_Axis(col_list, move_x, 1, sprite_list);
+    Col_Move_Swept_Axis(col_list, move_y, 0, sprite_list);
+}
+
+void cMovingSprite::Col_Move_Swept_Axis(cObjectCollisionType& col_list, float move, bool horizontal, cSprite_List& sprite_list)
+{
+    // nothing to do
+    if (Is_Float_Equal(move, 0.0f)) {
+        return;
+    }
+
+    const float dir = move > 0.0f ? 1.0f : -1.0f;
+    // the same step size as the pixel checking of Col_Move_in_Steps
+    const float step_size = fabs(move) < 1.0f ? fabs(move) : 1.0f;
+    const int max_steps = static_cast<int>(ceil(fabs(move) / step_size));
+    const float start_pos = horizontal ? m_pos_x : m_pos_y;
+    int steps_done = 0;
+
+    while (steps_done < max_steps) {
+        const int steps_left = max_steps - steps_done;
+        // first step touching an object
+        int hit_step = steps_left + 1;
+        cSprite_List& hit_objects = m_col_hit_objects;
+        hit_objects.clear();
+
+        for (cSprite_List::iterator itr = sprite_list.begin(); itr != sprite_list.end(); ++itr) {
+            const GL_rect& obj_rect = (*itr)->m_col_rect;
+
+            float pos, size, obj_pos, obj_size;
+
+            if (horizontal) {
+                // no vertical overlap
+                if (m_col_rect.m_y > obj_rect.m_y + obj_rect.m_h || m_col_rect.m_y + m_col_rect.m_h < obj_rect.m_y) {
+                    continue;
+                }
+
+                pos = m_col_rect.m_x;
+                size = m_col_rect.m_w;
+                obj_pos = obj_rect.m_x;
+                obj_size = obj_rect.m_w;
+            }
+            else {
+                // no horizontal overlap
+                if (m_col_rect.m_x > obj_rect.m_x + obj_rect.m_w || m_col_rect.m_x + m_col_rect.m_w < obj_rect.m_x) {
+                    continue;
+                }
+
+                pos = m_col_rect.m_y;
+                size = m_col_rect.m_h;
+                obj_pos = obj_rect.m_y;
+                obj_size = obj_rect.m_h;
+            }
+
+            // distance until the rects touch and until they separate again
+            const float contact = dir > 0.0f ? obj_pos - (pos + size) : pos - (obj_pos + obj_size);
+            const float separate = dir > 0.0f ? (obj_pos + obj_size) - pos : (pos + size) - obj_pos;
+
+            int step = static_cast<int>(ceil(contact / step_size));
+
+            if (step < 1) {
+                step = 1;
+            }
+
+            // passed or too far away
+            if (step * step_size > separate || step > steps_left || step > hit_step) {
+                continue;
+            }
+
+            if (step < hit_step) {
+                hit_step = step;
+                hit_objects.clear();
+            }
+
+            hit_objects.push_back(*itr);
+        }
+
+        // no more objects in the way
+        if (hit_objects.empty()) {
+            break;
+        }
+
+        // move to the last free step
+        if (hit_step > 1) {
+            steps_done += hit_step - 1;
+
+            if (horizontal) {
+                m_pos_x = start_pos + dir * step_size * steps_done;
+            }
+            else {
+                m_pos_y = start_pos + dir * step_size * steps_done;
+            }
+
+            Update_Position_Rect();
+        }
+
+        // collision check
+        cObjectCollisionType& col_list_temp = m_col_check_list;
+
+        if (horizontal) {
+            Collision_Check_Relative(col_list_temp, dir * step_size, 0.0f, 0.0f, 0.0f, COLLIDE_COMPLETE, &hit_objects);
+        }
+        else {
+            Collision_Check_Relative(col_list_temp, 0.0f, dir * step_size, 0.0f, 0.0f, COLLIDE_COMPLETE, &hit_objects);
+        }
+
+        hit_objects.clear();
+
+        bool collision_found = col_list_temp.Is_Included(COL_VTYPE_BLOCKING);
+
+        // remove internal collision from further checks
+        if (!collision_found) {
+            for (cObjectCollision_List::iterator itr = col_list_temp.objects.begin(); itr != col_list_temp.objects.end(); ++itr) {
+                cSprite_List::iterator sprite_itr = std::find(sprite_list.begin(), sprite_list.end(), (*itr)->m_obj);
+
+                if (sprite_itr != sprite_list.end()) {
+                    sprite_list.erase(sprite_itr);
+                }
+            }
+        }
+
+        if (col_list_temp.size()) {
+            col_list.objects.insert(col_list.objects.end(), col_list_temp.objects.begin(), col_list_temp.objects.end());
+            col_list_temp.objects.clear();
+        }
+
+        // stop before the blocking object
+        if (collision_found) {
+            return;
+        }
+
+        // move into the touched step
+        steps_done++;
+
+        if (steps_done < max_steps) {
+            if (horizontal) {
+                m_pos_x = start_pos + dir * step_size * steps_done;
+            }
+            else {
+                m_pos_y = start_pos + dir * step_size * steps_done;
+            }
+
+            Update_Position_Rect();
+        }
+    }
+
+    // move to final position
+    if (horizontal) {
+        m_pos_x = start_pos + move;
+    }
+    else {
+        m_pos_y = start_pos + move;
+    }
+
+    Update_Position_Rect();
 }
 
 void cMovingSprite::Col_Move(float move_x, float move_y, bool real /* = 0 */, bool force /* = 0 */, bool check_on_ground /* = 1 */)
@@ -442,8 +599,9 @@ void cMovingSprite::Col_Move(float move_x, float move_y, bool real /* = 0 */, bo
             complete_rect.m_h -= move_y;
         }
 
-        cSprite_List sprite_list;
-        m_sprite_manager->Get_Colliding_Objects(sprite_list, complete_rect, 1, this);
+        cSprite_List& sprite_list = m_col_move_objects;
+        sprite_list.clear();
+        m_sprite_manager->Get_Colliding_Objects(sprite_list, complete_rect, m_collision_cache, 1, this);
 
         // step size
         float step_size_x = move_x;
@@ -467,35 +625,47 @@ void cMovingSprite::Col_Move(float move_x, float move_y, bool real /* = 0 */, bo
         float final_pos_x = m_pos_x + move_x;
         float final_pos_y = m_pos_y + move_y;
 
-        // move in big steps
-        cObjectCollisionType* col_list = Col_Move_in_Steps(move_x, move_y, step_size_x, step_size_y, final_pos_x, final_pos_y, sprite_list, 1);
+        // found collisions
+        cObjectCollisionType& col_list = m_col_move_list;
 
-        // if a collision is found enter pixel checking
-        if (col_list && col_list->size()) {
-            // change to pixel checking
-            if (step_size_x < -1.0f) {
-                step_size_x = -1.0f;
-            }
-            else if (step_size_x > 1.0f) {
-                step_size_x = 1.0f;
-            }
+        // calculate the contact positions directly
+        if (pPreferences->m_swept_collision) {
+            Col_Move_Swept(col_list, move_x, move_y, sprite_list);
 
-            if (step_size_y < -1.0f) {
-                step_size_y = -1.0f;
-            }
-            else if (step_size_y > 1.0f) {
-                step_size_y = 1.0f;
+            if (col_list.size()) {
+                Add_Collisions(&col_list, 1);
             }
+        }
+        // move in big steps
+        else {
+            Col_Move_in_Steps(col_list, move_x, move_y, step_size_x, step_size_y, final_pos_x, final_pos_y, sprite_list, 1);
 
-            delete col_list;
-            col_list = Col_Move_in_Steps(move_x, move_y, step_size_x, step_size_y, final_pos_x, final_pos_y, sprite_list);
+            // if a collision is found enter pixel checking
+            if (col_list.size()) {
+                // change to pixel checking
+                if (step_size_x < -1.0f) {
+                    step_size_x = -1.0f;
+                }
+                else if (step_size_x > 1.0f) {
+                    step_size_x = 1.0f;
+                }
 
-            Add_Collisions(col_list, 1);
-        }
+                if (step_size_y < -1.0f) {
+                    step_size_y = -1.0f;
+                }
+                else if (step_size_y > 1.0f) {
+                    step_size_y = 1.0f;
+                }
 
-        if (col_list) {
-            delete col_list;
+                col_list.Delete_All();
+                Col_Move_in_Steps(col_list, move_x, move_y, step_size_x, step_size_y, final_pos_x, final_pos_y, sprite_list);
+
+                Add_Collisions(&col_list, 1);
+            }
         }
+
+        col_list.Delete_All();
+        sprite_list.clear();
     }
     // don't check for collisions
     else {
@@ -613,7 +783,7 @@ void cMovingSprite::Draw(cSurface_Request* request /* = NULL */)
     if (!request) {
         create_request = 1;
         // create request
-        request = new cSurface_Request();
+        request = pRenderer->Alloc<cSurface_Request>();
     }
 
     cSprite::Draw(request);
@@ -642,6 +812,14 @@ void cMovingSprite::Draw(cSurface_Request* request /* = NULL */)
 }
 
 cObjectCollisionType* cMovingSprite::Collision_Check_Absolute(const float x, const float y, const float w /* = 0 */, const float h /* = 0 */, const ColCheckType check_type /* = COLLIDE_COMPLETE */, cSprite_List* objects /* = NULL */)
+{
+    cObjectCollisionType* col_list = new cObjectCollisionType();
+    Collision_Check_Absolute(*col_list, x, y, w, h, check_type, objects);
+
+    return col_list;
+}
+
+void cMovingSprite::Collision_Check_Absolute(cObjectCollisionType& col_list, const float x, const float y, const float w /* = 0 */, const float h /* = 0 */, const ColCheckType check_type /* = COLLIDE_COMPLETE */, cSprite_List* objects /* = NULL */)
 {
     // save original rect
     GL_rect new_rect;
@@ -681,7 +859,7 @@ cObjectCollisionType* cMovingSprite::Collision_Check_Absolute(const float x, con
     // visual debugging
     if (game_debug) {
         // create request
-        cRect_Request* request = new cRect_Request();
+        cRect_Request* request = pRenderer->Alloc<cRect_Request>();
 
         pVideo->Draw_Rect(&new_rect, m_pos_z + 0.00001f, &green, request);
         request->m_no_camera = 0;
@@ -694,23 +872,31 @@ cObjectCollisionType* cMovingSprite::Collision_Check_Absolute(const float x, con
         pRenderer->Add(request);
     }
 
-    // return collisions list
-    return Collision_Check(&new_rect, check_type, objects);
+    // add collisions
+    Collision_Check(col_list, new_rect, check_type, objects);
 }
 
 cObjectCollisionType* cMovingSprite::Collision_Check(const GL_rect& new_rect, const ColCheckType check_type /* = COLLIDE_COMPLETE */, cSprite_List* objects /* = NULL */)
 {
     // blocking collisions list
     cObjectCollisionType* col_list = new cObjectCollisionType();
+    Collision_Check(*col_list, new_rect, check_type, objects);
 
+    return col_list;
+}
+
+void cMovingSprite::Collision_Check(cObjectCollisionType& col_list, const GL_rect& new_rect, const ColCheckType check_type /* = COLLIDE_COMPLETE */, cSprite_List* objects /* = NULL */)
+{
     // no width or height is invalid
     if (Is_Float_Equal(new_rect.m_w, 0.0f) || Is_Float_Equal(new_rect.m_h, 0.0f)) {
-        return col_list;
+        return;
     }
 
-    // if no object list is given get all objects available
+    // if no object list is given get the objects touching the rect
     if (!objects) {
-        objects = &m_sprite_manager->objects;
+        objects = &m_col_check_objects;
+        objects->clear();
+        m_sprite_manager->Get_Colliding_Objects(*objects, new_rect, m_collision_cache, 0, this);
 
         // Player
         if (m_type != TYPE_PLAYER && new_rect.Intersects(pActive_Player->m_col_rect)) {
@@ -733,7 +919,7 @@ cObjectCollisionType* cMovingSprite::Collision_Check(const GL_rect& new_rect, co
             // valid collision
             if (col_valid != COL_VTYPE_NOT_VALID) {
                 // add to list
-                col_list->Add(Create_Collision_Object(this, pActive_Player, col_valid));
+                col_list.Add(Create_Collision_Object(this, pActive_Player, col_valid));
             }
         }
     }
@@ -785,10 +971,12 @@ cObjectCollisionType* cMovingSprite::Collision_Check(const GL_rect& new_rect, co
         }
 
         // add to list
-        col_list->Add(Create_Collision_Object(this, level_object, col_valid));
+        col_list.Add(Create_Collision_Object(this, level_object, col_valid));
     }
 
-    return col_list;
+    if (objects == &m_col_check_objects) {
+        objects->clear();
+    }
 }
 
 void cMovingSprite::Check_And_Handle_Out_Of_Level(const float move_x, const float move_y)
@@ -893,25 +1081,29 @@ void cMovingSprite::Check_on_Ground(void)
     }
 
     // new onground check
-    cObjectCollisionType* col_list = Collision_Check_Relative(0.0f, m_col_rect.m_h, 0.0f, 1.0f, COLLIDE_ONLY_BLOCKING);
+    cObjectCollisionType& col_list = m_col_check_list;
+    Collision_Check_Relative(col_list, 0.0f, m_col_rect.m_h, 0.0f, 1.0f, COLLIDE_ONLY_BLOCKING);
 
     Reset_On_Ground();
 
     // possible ground objects
-    for (cObjectCollision_List::iterator itr = col_list->objects.begin(); itr != col_list->objects.end(); ++itr) {
-        cObjectCollision* col = (*itr);
-
+    for (cObjectCollision_List::iterator itr = col_list.objects.begin(); itr != col_list.objects.end(); ++itr) {
         // ground collision found
-        if (col->m_direction == DIR_BOTTOM) {
-            if (Set_On_Ground(col->m_obj)) {
+        if ((*itr)->m_direction == DIR_BOTTOM) {
+            /* copy as setting the ground can move us
+             * which reuses the collision list
+            */
+            cObjectCollision col = *(*itr);
+
+            if (Set_On_Ground(col.m_obj)) {
                 // send collision ( needed for falling platform )
-                Send_Collision(col);
+                Send_Collision(&col);
                 break;
             }
         }
     }
 
-    delete col_list;
+    col_list.Delete_All();
 }
 
 void cMovingSprite::Update_Anti_Stuck(void)
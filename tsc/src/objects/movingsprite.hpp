@@ -197,6 +197,11 @@ namespace TSC {
         {
             return Collision_Check_Absolute(m_col_rect.m_x + x, m_col_rect.m_y + y, w, h, check_type, objects);
         }
+        // Same as above but adds the collisions to the given list
+        void Collision_Check_Relative(cObjectCollisionType& col_list, const float x, const float y, const float w = 0.0f, const float h = 0.0f, const ColCheckType check_type = COLLIDE_COMPLETE, cSprite_List* objects = NULL)
+        {
+            Collision_Check_Absolute(col_list, m_col_rect.m_x + x, m_col_rect.m_y + y, w, h, check_type, objects);
+        }
         /* Check if the given position is valid
          * Creates a collision rect with the given values
          * check_type : set which collision types are added to the list
@@ -204,6 +209,8 @@ namespace TSC {
          * The collision data should be deleted if not used anymore
         */
         cObjectCollisionType* Collision_Check_Absolute(const float x, const float y, const float w = 0.0f, const float h = 0.0f, const ColCheckType check_type = COLLIDE_COMPLETE, cSprite_List* objects = NULL);
+        // Same as above but adds the collisions to the given list
+        void Collision_Check_Absolute(cObjectCollisionType& col_list, const float x, const float y, const float w = 0.0f, const float h = 0.0f, const ColCheckType check_type = COLLIDE_COMPLETE, cSprite_List* objects = NULL);
         /* Check if the given position is valid
          * new_rect : this is the source collision rect
          * check_type : set which collision types are added to the list
@@ -211,6 +218,10 @@ namespace TSC {
          * The collision data should be deleted if not used anymore
         */
         cObjectCollisionType* Collision_Check(const GL_rect& new_rect, const ColCheckType check_type = COLLIDE_COMPLETE, cSprite_List* objects = NULL);
+        /* Same as above but adds the collisions to the given list
+         * the list is not cleared and can be reused to avoid allocations
+        */
+        void Collision_Check(cObjectCollisionType& col_list, const GL_rect& new_rect, const ColCheckType check_type = COLLIDE_COMPLETE, cSprite_List* objects = NULL);
 
         // Check if the given movement goes out of the level rect and handle possible out of level events
         void Check_And_Handle_Out_Of_Level(const float move_x, const float move_y);
@@ -304,11 +315,36 @@ namespace TSC {
 
     private:
         /* moves in steps and checks in both directions simultaneous
-         * returns the found collisions
+         * adds the found collisions to col_list
          * sprite_list : objects to check
          * stop_on_internal : if set stops moving if internal collision was found
+         * if stop_on_internal is not set found internal collision objects are removed from sprite_list
+        */
+        void Col_Move_in_Steps(cObjectCollisionType& col_list, float move_x, float move_y, float step_size_x, float step_size_y, float final_pos_x, float final_pos_y, cSprite_List& sprite_list, bool stop_on_internal = 0);
+        /* moves first horizontal and then vertical to the first blocking collision
+         * the contact step of every object is calculated directly instead of checking every pixel step
+         * adds the found collisions to col_list
+         * sprite_list : objects to check
+        */
+        void Col_Move_Swept(cObjectCollisionType& col_list, float move_x, float move_y, cSprite_List& sprite_list);
+        // moves on one axis for Col_Move_Swept
+        void Col_Move_Swept_Axis(cObjectCollisionType& col_list, float move, bool horizontal, cSprite_List& sprite_list);
+
+        /* Lists reused by the collision functions to avoid allocations
+         * they are always empty outside of these functions
         */
-        cObjectCollisionType* Col_Move_in_Steps(float move_x, float move_y, float step_size_x, float step_size_y, float final_pos_x, float final_pos_y, cSprite_List sprite_list, bool stop_on_internal = 0);
+        // Col_Move objects to check
+        cSprite_List m_col_move_objects;
+        // Col_Move_Swept_Axis objects touched in the same step
+        cSprite_List m_col_hit_objects;
+        // Collision_Check objects found in the sprite manager
+        cSprite_List m_col_check_objects;
+        // Col_Move found collisions
+        cObjectCollisionType m_col_move_list;
+        // collisions of a single check
+        cObjectCollisionType m_col_check_list;
+        // objects around the last collision query
+        cCollision_Cache m_collision_cache;
     };
 
     /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
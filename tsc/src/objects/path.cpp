@@ -476,6 +476,8 @@ void cPath::Init(void)
     m_sprite_array = ARRAY_ACTIVE;
     m_type = TYPE_PATH;
     m_massive_type = MASS_PASSIVE;
+    // linked objects move along it everywhere
+    m_always_active = 1;
     m_editor_pos_z = 0.11f;
     m_show_line = false;
 
@@ -677,7 +679,7 @@ void cPath::Draw(cSurface_Request* request /* = NULL */)
         }
 
         // create request
-        cLine_Request* line_request = new cLine_Request();
+        cLine_Request* line_request = pRenderer->Alloc<cLine_Request>();
         pVideo->Draw_Line(m_col_rect.m_x + obj.m_x1 - pActive_Camera->m_x, m_col_rect.m_y + obj.m_y1 - pActive_Camera->m_y, m_col_rect.m_x + obj.m_x2 - pActive_Camera->m_x, m_col_rect.m_y + obj.m_y2 - pActive_Camera->m_y, m_editor_pos_z + 0.00001f, &line_color, line_request);
         line_request->m_line_width = 2;
         // add request
@@ -110,6 +110,8 @@ void cSecret_Area::Update(void)
             CEGUI::System::getSingleton().getDefaultGUIContext().getRootWindow()->removeChild(mp_msg_window);
             CEGUI::WindowManager::getSingleton().destroyWindow(mp_msg_window);
             mp_msg_window = NULL;
+            // message is gone
+            Set_Always_Active(0);
         }
         else {
             mp_msg_window->setAlpha(1.0f - m_transparency_counter * alpha_max);
@@ -139,7 +141,7 @@ void cSecret_Area::Draw(cSurface_Request* request /* = NULL */)
         return;
 
     // draw rect
-    cRect_Request* req = new cRect_Request();
+    cRect_Request* req = pRenderer->Alloc<cRect_Request>();
     pVideo->Draw_Rect(m_col_rect.m_x - pActive_Camera->m_x, m_col_rect.m_y - pActive_Camera->m_y, m_col_rect.m_w, m_col_rect.m_h, m_editor_pos_z, &orange, req);
     req->m_filled = 0;
     req->m_line_width = 6.0f;
@@ -179,6 +181,8 @@ void cSecret_Area::Activate(void)
     m_transparency_counter = 0.0f;
     m_move_counter = 0.0f;
     m_activated = true;
+    // fade out the message even if the player leaves
+    Set_Always_Active(1);
 
     Scripting::cActivate_Event evt;
     evt.Fire(pActive_Level->m_mruby, this);
@@ -113,6 +113,8 @@ void cSpinBox::Activate(void)
 
     m_spin = 1;
     Update_Valid_Update();
+    // keep the spin timer running away from the camera
+    Set_Always_Active(1);
     // passive box for spinning
     m_massive_type = MASS_PASSIVE;
 
@@ -139,6 +141,7 @@ void cSpinBox::Stop(void)
     // reset
     m_spin = 0;
     Update_Valid_Update();
+    Set_Always_Active(0);
     m_spin_counter = 0.0f;
 
     // back to a massive box
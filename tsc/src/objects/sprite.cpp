@@ -62,7 +62,9 @@ void cCollidingSprite::Set_Sprite_Manager(cSprite_Manager* sprite_manager)
 void cCollidingSprite::Handle_Collisions(void)
 {
     // get collision list
-    cObjectCollision_List col_list;
+    cObjectCollision_List nested_col_list;
+    // if called from a collision handler the handled list is still in use
+    cObjectCollision_List& col_list = m_collisions_handled.empty() ? m_collisions_handled : nested_col_list;
     m_collisions.swap(col_list);
 
     // parse the given collisions
@@ -346,6 +348,17 @@ cSprite::cSprite(XmlAttributes& attributes, cSprite_Manager* sprite_manager, con
 
 cSprite::~cSprite(void)
 {
+    if (m_activity_entry.m_regions) {
+        m_activity_entry.m_regions->Remove(this);
+    }
+
+    if (m_spatial_hash_entry.m_hash) {
+        m_spatial_hash_entry.m_hash->Remove(this);
+    }
+    else if (m_static_collision_index >= 0) {
+        m_sprite_manager->m_static_collision.Remove(this);
+    }
+
     if (m_delete_image && m_image) {
         delete m_image;
         m_image = NULL;
@@ -375,6 +388,7 @@ void cSprite::Init(void)
     m_col_rect.m_y = 0.0f;
     m_col_rect.m_w = 0.0f;
     m_col_rect.m_h = 0.0f;
+    m_static_collision_index = -1;
     // image data
     m_rect.m_x = 0.0f;
     m_rect.m_y = 0.0f;
@@ -402,6 +416,9 @@ void cSprite::Init(void)
 
     m_pos_x = 0.0f;
     m_pos_y = 0.0f;
+    m_step_pos_x = 0.0f;
+    m_step_pos_y = 0.0f;
+    m_step_pos_valid = 0;
     m_pos_z = 0.0f;
     m_editor_pos_z = 0.0f;
 
@@ -410,6 +427,9 @@ void cSprite::Init(void)
     m_spawned = 0;
     m_suppress_save = 0;
     m_camera_range = 1000;
+    m_always_active = 0;
+    m_parallel_think = 0;
+    m_think_frame = 0;
     m_can_be_ground = 0;
     m_disallow_managed_delete = 0;
 
@@ -738,6 +758,31 @@ void cSprite::Set_Active(bool enabled)
     Update_Valid_Update();
 }
 
+void cSprite::Set_Always_Active(bool enable)
+{
+    m_always_active = enable;
+
+    if (m_activity_entry.m_regions) {
+        m_activity_entry.m_regions->Update(this);
+    }
+}
+
+void cSprite::Prepare_Think(void)
+{
+    // not part of the think phase of this frame
+    if (m_think_frame != cSprite_Manager::m_think_frame) {
+        Think();
+    }
+}
+
+void cSprite::register_event_handler(const std::string& evtname, mrb_value callback)
+{
+    cCollidingSprite::register_event_handler(evtname, callback);
+
+    // scripts may expect the events from everywhere in the level
+    Set_Always_Active(1);
+}
+
 /** Set a Color Combination ( GL_ADD, GL_MODULATE or GL_REPLACE ).
  * Addition ( adds white to color )
  * 1.0 is the maximum and the given color will be white
@@ -941,6 +986,20 @@ void cSprite::Update_Position_Rect(void)
         m_col_rect.m_y = m_pos_y + m_col_pos.m_y;
     }
 
+    // move in the activity regions
+    if (m_activity_entry.m_regions) {
+        m_activity_entry.m_regions->Update(this);
+    }
+
+    // move in the collision broadphase
+    if (m_spatial_hash_entry.m_hash) {
+        m_spatial_hash_entry.m_hash->Update(this);
+    }
+    // static sprite moved
+    else if (m_static_collision_index >= 0) {
+        m_sprite_manager->Update_Static_Collision(this);
+    }
+
     Update_Valid_Draw();
 }
 
@@ -966,7 +1025,7 @@ void cSprite::Draw(cSurface_Request* request /* = NULL */)
     if (game_debug) {
         // - image rect
         // create request
-        cRect_Request* rect_request = new cRect_Request();
+        cRect_Request* rect_request = pRenderer->Alloc<cRect_Request>();
         // draw
         pVideo->Draw_Rect(&m_rect, m_pos_z + 0.000008f, &lightgrey, rect_request);
         rect_request->m_no_camera = m_no_camera;
@@ -1000,7 +1059,7 @@ void cSprite::Draw(cSurface_Request* request /* = NULL */)
 
         // - collision rect
         // create request
-        rect_request = new cRect_Request();
+        rect_request = pRenderer->Alloc<cRect_Request>();
         // draw
         Color sprite_color = Get_Sprite_Color(this);
         pVideo->Draw_Rect(&m_col_rect, m_pos_z + 0.000007f, &sprite_color, rect_request);
@@ -1016,7 +1075,7 @@ void cSprite::Draw(cSurface_Request* request /* = NULL */)
     // show obsolete images in editor
     if (editor_enabled && m_image && m_image->m_obsolete) {
         // create request
-        cRect_Request* rect_request = new cRect_Request();
+        cRect_Request* rect_request = pRenderer->Alloc<cRect_Request>();
         // draw
         pVideo->Draw_Rect(&m_col_rect, m_pos_z + 0.000005f, &red, rect_request);
         rect_request->m_no_camera = 0;
@@ -1041,7 +1100,7 @@ void cSprite::Draw_Image(cSurface_Request* request /* = NULL */) const
     if (!request) {
         create_request = 1;
         // create request
-        request = new cSurface_Request();
+        request = pRenderer->Alloc<cSurface_Request>();
     }
 
     // editor
@@ -1063,6 +1122,7 @@ void cSprite::Draw_Image_Normal(cSurface_Request* request /* = NULL */) const
 {
     // texture id
     request->m_texture_id = m_image->m_image;
+    request->m_tex_rect = m_image->m_tex_rect;
 
     // size
     request->m_w = m_image->m_start_w;
@@ -1155,6 +1215,7 @@ void cSprite::Draw_Image_Editor(cSurface_Request* request /* = NULL */) const
 {
     // texture id
     request->m_texture_id = m_start_image->m_image;
+    request->m_tex_rect = m_start_image->m_tex_rect;
 
     // size
     request->m_w = m_start_image->m_start_w;
@@ -1414,6 +1475,11 @@ void cSprite::Destroy(void)
     m_valid_draw = 0;
     m_valid_update = 0;
     Set_Image(NULL, 1);
+
+    // can be replaced by new objects
+    if (m_sprite_manager) {
+        m_sprite_manager->Add_Destroyed(this);
+    }
 }
 
 /**
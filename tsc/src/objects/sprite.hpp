@@ -21,7 +21,10 @@
 #include "../core/math/rect.hpp"
 #include "../video/video.hpp"
 #include "../video/img_set.hpp"
+#include "../core/obj_manager.hpp"
 #include "../core/collision.hpp"
+#include "../core/spatial_hash.hpp"
+#include "../core/activity_regions.hpp"
 #include "../scripting/scriptable_object.hpp"
 #include "../scripting/scripting.hpp"
 #include "../scripting/objects/sprites/mrb_sprite.hpp"
@@ -110,6 +113,8 @@ namespace TSC {
         cSprite_Manager* m_sprite_manager;
         // object collision list
         cObjectCollision_List m_collisions;
+        // collisions handled in Handle_Collisions, keeps its memory for the next call
+        cObjectCollision_List m_collisions_handled;
     };
 
     /* *** *** *** *** *** *** *** cSprite *** *** *** *** *** *** *** *** *** *** */
@@ -185,6 +190,12 @@ namespace TSC {
         void Set_Pos_Y(float y, bool new_startpos = 0);
         // Set if active
         virtual void Set_Active(bool enabled);
+        /* Set if updated even if far away from the camera
+         * used by objects which other objects depend on
+        */
+        void Set_Always_Active(bool enable);
+        // Register the handler and keep this always active
+        virtual void register_event_handler(const std::string& evtname, mrb_value callback);
         /* Set the shadow
          * if position is set to 0 the shadow is disabled
         */
@@ -367,6 +378,22 @@ namespace TSC {
         void Update_Position_Rect(void);
         // default update, derived updates should not call this again if they also call Update_Animation()
         virtual void Update(void) { Update_Animation(); };
+        /* Compute the decisions for the next Update
+         * The sprite manager calls this for all sprites with m_parallel_think
+         * at once on several threads before updating them. It must only read
+         * other objects and only write its own intent members. Update applies
+         * the intent and should call Prepare_Think first.
+        */
+        virtual void Think(void) {};
+        // Think now if not already done for this frame
+        void Prepare_Think(void);
+        // Remember the position at the start of a fixed simulation step
+        inline void Save_Step_Pos(void)
+        {
+            m_step_pos_x = m_pos_x;
+            m_step_pos_y = m_pos_y;
+            m_step_pos_valid = 1;
+        }
         /* late update
          * use if it is needed that other objects are already updated
         */
@@ -467,6 +494,14 @@ namespace TSC {
         GL_rect m_col_rect;
         /// collision start point
         GL_point m_col_pos;
+        /// spatial hash registration of the collision rect
+        cSpatial_Hash_Entry m_spatial_hash_entry;
+        /// index in the static collision list or -1 if dynamic
+        int m_static_collision_index;
+        /// activity regions registration of the rect center
+        cActivity_Entry m_activity_entry;
+        /// position in the sprite or animation manager
+        cObject_Manager_Entry m_manager_entry;
 
         /// current position
         float m_pos_x;
@@ -475,6 +510,11 @@ namespace TSC {
         /// start position
         float m_start_pos_x;
         float m_start_pos_y;
+        /// position at the start of the last fixed simulation step
+        float m_step_pos_x;
+        float m_step_pos_y;
+        /// if the step position was set
+        bool m_step_pos_valid;
         /** editor z position
          * it's only used if not 0
         */
@@ -545,6 +585,12 @@ namespace TSC {
         bool m_suppress_save;
         /// maximum distance to the camera to get updated
         unsigned int m_camera_range;
+        /// if set this is updated even if far away from the camera
+        bool m_always_active;
+        /// if set Think is called in the parallel think phase
+        bool m_parallel_think;
+        /// think frame of the sprite manager Think was last called in
+        uint32_t m_think_frame;
         /// can be used as ground object
         bool m_can_be_ground;
 
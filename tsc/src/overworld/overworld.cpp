@@ -478,6 +478,9 @@ void cOverworld::Process_Input()
 
 void cOverworld::Update(void)
 {
+    // remove the objects deleted in the last frame
+    m_sprite_manager->Compact();
+
     if (!editor_world_enabled) {
         // Camera
         Update_Camera();
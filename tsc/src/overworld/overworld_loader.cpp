@@ -190,9 +190,10 @@ cSprite* cOverworldLoader::Create_Sprite_From_XML_Tag(XmlAttributes& attributes,
     if (engine_version < 2) {
         // old version: change file and position name
         if (attributes.exists("filename")) {
-            attributes["image"] = attributes["filename"];
-            attributes["posx"] = attributes["pos_x"];
-            attributes["posy"] = attributes["pos_y"];
+            // copied as adding a key invalidates the references to the other values
+            attributes["image"] = attributes.fetch<std::string>("filename", "");
+            attributes["posx"] = attributes.fetch<std::string>("pos_x", "");
+            attributes["posy"] = attributes.fetch<std::string>("pos_y", "");
         }
 
         // If V.1.9 and lower: move y coordinate bottom to 0
@@ -197,7 +197,7 @@ void cLayer_Line_Point_Start::Draw(cSurface_Request* request /* = NULL */)
     }
 
     // create request
-    cLine_Request* line_request = new cLine_Request();
+    cLine_Request* line_request = pRenderer->Alloc<cLine_Request>();
 
     // drawing color
     Color color = darkgreen;
@@ -493,7 +493,7 @@ cLine_collision cLayer::Get_Nearest_Line(cLayer_Line_Point_Start* map_layer_line
         // debug drawing
         if (pOverworld_Manager->m_debug_mode && pOverworld_Manager->m_draw_layer) {
             // create request
-            cLine_Request* line_request = new cLine_Request();
+            cLine_Request* line_request = pRenderer->Alloc<cLine_Request>();
             pVideo->Draw_Line(line_1.m_x1 - pActive_Camera->m_x, line_1.m_y1 - pActive_Camera->m_y, line_1.m_x2 - pActive_Camera->m_x, line_1.m_y2 - pActive_Camera->m_y, map_layer_line->m_pos_z + 0.001f, &white, line_request);
             line_request->m_line_width = 2;
             line_request->m_render_count = 50;
@@ -501,7 +501,7 @@ cLine_collision cLayer::Get_Nearest_Line(cLayer_Line_Point_Start* map_layer_line
             pRenderer->Add(line_request);
 
             // create request
-            line_request = new cLine_Request();
+            line_request = pRenderer->Alloc<cLine_Request>();
             pVideo->Draw_Line(line_2.m_x1 - pActive_Camera->m_x, line_2.m_y1 - pActive_Camera->m_y, line_2.m_x2 - pActive_Camera->m_x, line_2.m_y2 - pActive_Camera->m_y, map_layer_line->m_pos_z + 0.001f, &black, line_request);
             line_request->m_line_width = 2;
             line_request->m_render_count = 50;
@@ -191,7 +191,7 @@ void cOverworld_Player::Draw(cSurface_Request* request /* = NULL */)
     if (!request) {
         create_request = 1;
         // create request
-        request = new cSurface_Request();
+        request = pRenderer->Alloc<cSurface_Request>();
     }
 
     // Draw player
@@ -238,7 +238,7 @@ void cWaypoint::Draw(cSurface_Request* request /* = NULL  */)
                 y = m_rect.m_y - pActive_Camera->m_y;
 
                 // create request
-                cSurface_Request* surface_request = new cSurface_Request();
+                cSurface_Request* surface_request = pRenderer->Alloc<cSurface_Request>();
 
                 if (m_direction_backward == DIR_RIGHT) {
                     x += m_rect.m_w;
@@ -271,7 +271,7 @@ void cWaypoint::Draw(cSurface_Request* request /* = NULL  */)
                 y = m_rect.m_y - pActive_Camera->m_y;
 
                 // create request
-                cSurface_Request* surface_request = new cSurface_Request();
+                cSurface_Request* surface_request = pRenderer->Alloc<cSurface_Request>();
 
                 if (m_direction_forward == DIR_RIGHT) {
                     x += m_rect.m_w;
@@ -337,7 +337,7 @@ void cWaypoint::Draw(cSurface_Request* request /* = NULL  */)
                 }
 
                 // create request
-                cSurface_Request* surface_request = new cSurface_Request();
+                cSurface_Request* surface_request = pRenderer->Alloc<cSurface_Request>();
                 arrow->Blit(x, y, 0.089f, surface_request);
                 surface_request->m_shadow_pos = 2;
                 surface_request->m_shadow_color = lightgreyalpha64;
@@ -356,7 +356,7 @@ void cWaypoint::Draw(cSurface_Request* request /* = NULL  */)
         if (!request) {
             create_request = 1;
             // create request
-            request = new cSurface_Request();
+            request = pRenderer->Alloc<cSurface_Request>();
         }
 
         // draw
@@ -64,18 +64,15 @@ static mrb_value _Index(mrb_state* p_state, mrb_value cache, mrb_value ruid)
 
     // Otherwise, allocate a new MRuby object for it and store
     // that new object in the cache.
-    cSprite_List objs = pActive_Level->m_sprite_manager->objects; // Shorthand
-    mrb_int uid = mrb_fixnum(ruid);
-    for (cSprite_List::const_iterator iter = objs.begin(); iter != objs.end(); iter++) {
-        if ((*iter)->m_uid == uid) {
-            // Ask the sprite to create the correct type of MRuby object
-            // so we don’t have to maintain a static C++/MRuby type mapping table
-            mrb_value obj = (*iter)->Create_MRuby_Object(p_state);
-            // Store it in the cache
-            mrb_hash_set(p_state, cache, ruid, obj);
-
-            return obj;
-        }
+    cSprite* p_sprite = pActive_Level->m_sprite_manager->Get_by_UID(mrb_fixnum(ruid));
+    if (p_sprite) {
+        // Ask the sprite to create the correct type of MRuby object
+        // so we don’t have to maintain a static C++/MRuby type mapping table
+        mrb_value obj = p_sprite->Create_MRuby_Object(p_state);
+        // Store it in the cache
+        mrb_hash_set(p_state, cache, ruid, obj);
+
+        return obj;
     }
 
     return mrb_nil_value();
@@ -30,7 +30,7 @@ namespace TSC {
             virtual ~cScriptable_Object();
 
             void clear_event_handlers(const std::string& levelname = "");
-            void register_event_handler(const std::string& evtname, mrb_value callback);
+            virtual void register_event_handler(const std::string& evtname, mrb_value callback);
             std::vector<mrb_value>::iterator event_handlers_begin(const std::string& evtname);
             std::vector<mrb_value>::iterator event_handlers_end(const std::string& evtname);
 
@@ -19,6 +19,7 @@
 #include "../core/property_helper.hpp"
 #include "../core/filesystem/resource_manager.hpp"
 #include "../core/i18n.hpp"
+#include "../core/math/random.hpp"
 #include "../audio/audio.hpp"
 #include "../user/savegame/savegame.hpp"
 #include "../input/keyboard.hpp"
@@ -105,6 +106,8 @@ cMRuby_Interpreter::cMRuby_Interpreter(cLevel* p_level)
 
     // Load TSC classes into mruby
     Load_Wrappers();
+    // Seed the script random numbers from the scripting stream
+    mrb_funcall(mp_mruby, mrb_top_self(mp_mruby), "srand", 1, mrb_fixnum_value(Get_Random_Stream(RANDOM_STREAM_SCRIPTING).Next() & 0x7FFFFFFF));
     // Load scripting library
     Load_Scripts();
 }
@@ -194,6 +194,10 @@ void cPreferences::Save(void)
     // Special
     Add_Property(p_root, "level_background_images", m_level_background_images);
     Add_Property(p_root, "image_cache_enabled", m_image_cache_enabled);
+    Add_Property(p_root, "level_cache_enabled", m_level_cache_enabled);
+    Add_Property(p_root, "swept_collision", m_swept_collision);
+    Add_Property(p_root, "fixed_step_rate", m_fixed_step_rate);
+    Add_Property(p_root, "level_streaming", m_level_streaming);
     // Editor
     Add_Property(p_root, "editor_mouse_auto_hide", m_editor_mouse_auto_hide);
     Add_Property(p_root, "editor_show_item_images", m_editor_show_item_images);
@@ -218,6 +222,10 @@ void cPreferences::Reset_All(void)
     // Special
     m_level_background_images = 1;
     m_image_cache_enabled = 1;
+    m_level_cache_enabled = 1;
+    m_swept_collision = 0;
+    m_fixed_step_rate = 0;
+    m_level_streaming = 0;
 }
 
 void cPreferences::Reset_Game(void)
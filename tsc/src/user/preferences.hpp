@@ -134,6 +134,14 @@ namespace TSC {
         bool m_level_background_images;
         // image cache enabled
         bool m_image_cache_enabled;
+        // binary level cache enabled
+        bool m_level_cache_enabled;
+        // calculate the collision contact positions directly instead of pixel steps
+        bool m_swept_collision;
+        // simulation steps per second or 0 to simulate once every frame
+        uint16_t m_fixed_step_rate;
+        // create the static sprites of big levels only near the camera
+        bool m_level_streaming;
 
         /* *** *** *** *** *** *** *** */
 
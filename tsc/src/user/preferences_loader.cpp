@@ -332,6 +332,14 @@ void cPreferencesLoader::handle_property(const std::string& name, const std::str
         mp_preferences->m_level_background_images = string_to_bool(value);
     else if (name == "image_cache_enabled")
         mp_preferences->m_image_cache_enabled = string_to_bool(value);
+    else if (name == "level_cache_enabled")
+        mp_preferences->m_level_cache_enabled = string_to_bool(value);
+    else if (name == "swept_collision")
+        mp_preferences->m_swept_collision = string_to_bool(value);
+    else if (name == "fixed_step_rate")
+        mp_preferences->m_fixed_step_rate = string_to_int(value);
+    else if (name == "level_streaming")
+        mp_preferences->m_level_streaming = string_to_bool(value);
     //////////////////// Editor ////////////////////
     else if (name == "editor_mouse_auto_hide")
         mp_preferences->m_editor_mouse_auto_hide = string_to_bool(value);
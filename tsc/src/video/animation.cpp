@@ -20,6 +20,7 @@
 #include "../video/gl_surface.hpp"
 #include "../video/renderer.hpp"
 #include "../core/math/utilities.hpp"
+#include "../core/math/random.hpp"
 #include "../core/i18n.hpp"
 #include "../core/filesystem/filesystem.hpp"
 #include "../core/filesystem/resource_manager.hpp"
@@ -332,7 +333,7 @@ void cAnimation_Fireball::Draw(cSurface_Request* request /* = NULL */)
         cAnimation_Fireball_Item* obj = (*itr);
 
         // create request
-        cSurface_Request* request = new cSurface_Request();
+        cSurface_Request* request = pRenderer->Alloc<cSurface_Request>();
         obj->m_image->Blit(obj->m_pos_x - (pActive_Camera->m_x - m_pos_x), obj->m_pos_y - (pActive_Camera->m_y - m_pos_y), obj->m_pos_z, request);
 
         // scale
@@ -347,120 +348,95 @@ void cAnimation_Fireball::Draw(cSurface_Request* request /* = NULL */)
     }
 }
 
-/* *** *** *** *** *** *** *** cParticle *** *** *** *** *** *** *** *** *** *** */
-
-cParticle::cParticle(cParticle_Emitter* parent)
-    : cMovingSprite(parent->m_sprite_manager)
-{
-    m_can_be_on_ground = 0;
-    // scale centered
-    Set_Scale_Directions(1, 1, 1, 1);
-
-    m_time_to_live = 0.0f;
-    m_const_rot_x = 0.0f;
-    m_const_rot_y = 0.0f;
-    m_const_rot_z = 0.0f;
-    m_gravity_x = 0.0f;
-    m_gravity_y = 0.0f;
-
-    m_fade_pos = 1.0f;
-
-    m_parent = parent;
-}
-
-cParticle::~cParticle(void)
-{
-
-}
-
-void cParticle::Update(void)
-{
-    // update fade modifier
-    m_fade_pos -= ((static_cast<float>(speedfactor_fps) * 0.001f) * pFramerate->m_speed_factor) / m_time_to_live;
-
-    // finished fading
-    if (m_fade_pos <= 0.0f) {
-        m_fade_pos = 0.0f;
-        Set_Active(0);
-        return;
-    }
-
-    // with size fading
-    if (m_parent->m_fade_size) {
-        Set_Scale(m_start_scale_x * m_fade_pos);
-    }
-
-    // move
-    Move(m_velx, m_vely);
-    // todo : gravity maximum
-    Add_Velocity(m_gravity_x, m_gravity_y);
-
-    // constant rotation
-    if (!Is_Float_Equal(m_const_rot_x, 0.0f)) {
-        Add_Rotation_X(m_const_rot_x * pFramerate->m_speed_factor);
-    }
-    if (!Is_Float_Equal(m_const_rot_y, 0.0f)) {
-        Add_Rotation_Y(m_const_rot_y * pFramerate->m_speed_factor);
-    }
-    if (!Is_Float_Equal(m_const_rot_z, 0.0f)) {
-        Add_Rotation_Z(m_const_rot_z * pFramerate->m_speed_factor);
-    }
-}
-
-void cParticle::Draw(cSurface_Request* request /* = NULL */)
-{
-    if (!m_image) {
-        return;
-    }
-
-    bool create_request = 0;
-
-    if (!request) {
-        create_request = 1;
-        // create request
-        request = new cSurface_Request();
-    }
-
-    Draw_Image_Normal(request);
-
-    // based on emitter position
-    if (m_parent->m_particle_based_on_emitter_pos > 0.0f) {
-        request->m_pos_x += (m_parent->m_pos_x * m_parent->m_particle_based_on_emitter_pos);
-        request->m_pos_y += (m_parent->m_pos_y * m_parent->m_particle_based_on_emitter_pos);
-    }
-
-    // blending
-    if (m_parent->m_blending == BLEND_ADD) {
-        request->m_blend_sfactor = GL_SRC_ALPHA;
-        request->m_blend_dfactor = GL_ONE;
-    }
-    else if (m_parent->m_blending == BLEND_DRIVE) {
-        request->m_blend_sfactor = GL_SRC_COLOR;
-        request->m_blend_dfactor = GL_DST_ALPHA;
-    }
-
-    // color fading
-    if (m_parent->m_fade_color) {
-        request->m_color.red = static_cast<uint8_t>(m_color.red * m_fade_pos);
-        request->m_color.green = static_cast<uint8_t>(m_color.green * m_fade_pos);
-        request->m_color.blue = static_cast<uint8_t>(m_color.blue * m_fade_pos);
-    }
-
-    // alpha fading
-    if (m_parent->m_fade_alpha) {
-        request->m_color.alpha = static_cast<uint8_t>(request->m_color.alpha * m_fade_pos);
-    }
-
-    if (create_request) {
-        // add request
-        pRenderer->Add(request);
-    }
-}
-
-void cParticle::Set_Gravity(float x, float y)
-{
-    m_gravity_x = x;
-    m_gravity_y = y;
+/* *** *** *** *** *** *** *** cParticle_Store *** *** *** *** *** *** *** *** *** *** */
+
+void cParticle_Store::Resize(size_t count)
+{
+    m_pos_x.resize(count, 0.0f);
+    m_pos_y.resize(count, 0.0f);
+    m_pos_z.resize(count, 0.0f);
+    m_vel_x.resize(count, 0.0f);
+    m_vel_y.resize(count, 0.0f);
+    m_gravity_x.resize(count, 0.0f);
+    m_gravity_y.resize(count, 0.0f);
+    m_rot_x.resize(count, 0.0f);
+    m_rot_y.resize(count, 0.0f);
+    m_rot_z.resize(count, 0.0f);
+    m_const_rot_x.resize(count, 0.0f);
+    m_const_rot_y.resize(count, 0.0f);
+    m_const_rot_z.resize(count, 0.0f);
+    m_scale.resize(count, 1.0f);
+    m_start_scale.resize(count, 1.0f);
+    m_time_to_live.resize(count, 0.0f);
+    m_fade_pos.resize(count, 1.0f);
+    m_color.resize(count, white);
+}
+
+void cParticle_Store::Remove(size_t index)
+{
+    const size_t last = m_fade_pos.size() - 1;
+
+    if (index != last) {
+        m_pos_x[index] = m_pos_x[last];
+        m_pos_y[index] = m_pos_y[last];
+        m_pos_z[index] = m_pos_z[last];
+        m_vel_x[index] = m_vel_x[last];
+        m_vel_y[index] = m_vel_y[last];
+        m_gravity_x[index] = m_gravity_x[last];
+        m_gravity_y[index] = m_gravity_y[last];
+        m_rot_x[index] = m_rot_x[last];
+        m_rot_y[index] = m_rot_y[last];
+        m_rot_z[index] = m_rot_z[last];
+        m_const_rot_x[index] = m_const_rot_x[last];
+        m_const_rot_y[index] = m_const_rot_y[last];
+        m_const_rot_z[index] = m_const_rot_z[last];
+        m_scale[index] = m_scale[last];
+        m_start_scale[index] = m_start_scale[last];
+        m_time_to_live[index] = m_time_to_live[last];
+        m_fade_pos[index] = m_fade_pos[last];
+        m_color[index] = m_color[last];
+    }
+
+    m_pos_x.pop_back();
+    m_pos_y.pop_back();
+    m_pos_z.pop_back();
+    m_vel_x.pop_back();
+    m_vel_y.pop_back();
+    m_gravity_x.pop_back();
+    m_gravity_y.pop_back();
+    m_rot_x.pop_back();
+    m_rot_y.pop_back();
+    m_rot_z.pop_back();
+    m_const_rot_x.pop_back();
+    m_const_rot_y.pop_back();
+    m_const_rot_z.pop_back();
+    m_scale.pop_back();
+    m_start_scale.pop_back();
+    m_time_to_live.pop_back();
+    m_fade_pos.pop_back();
+    m_color.pop_back();
+}
+
+void cParticle_Store::Clear(void)
+{
+    m_pos_x.clear();
+    m_pos_y.clear();
+    m_pos_z.clear();
+    m_vel_x.clear();
+    m_vel_y.clear();
+    m_gravity_x.clear();
+    m_gravity_y.clear();
+    m_rot_x.clear();
+    m_rot_y.clear();
+    m_rot_z.clear();
+    m_const_rot_x.clear();
+    m_const_rot_y.clear();
+    m_const_rot_z.clear();
+    m_scale.clear();
+    m_start_scale.clear();
+    m_time_to_live.clear();
+    m_fade_pos.clear();
+    m_color.clear();
 }
 
 /* *** *** *** *** *** *** *** cParticle_Emitter *** *** *** *** *** *** *** *** *** *** */
@@ -625,6 +601,8 @@ void cParticle_Emitter::Init(void)
     // animation data
     m_emit_counter = 0.0f;
     m_emitter_living_time = 0.0f;
+    m_lod_speed_factor = 0.0f;
+    m_lod_skipped_frames = 0;
 }
 
 cParticle_Emitter* cParticle_Emitter::Copy(void) const
@@ -758,128 +736,130 @@ void cParticle_Emitter::Pre_Update(void)
     pFramerate->m_speed_factor = old_speedfactor;
 }
 
+/* Set the values to the base value plus a random value up to rand
+*/
+static void Fill_Particle_Values(float* values, size_t count, float base, float rand)
+{
+    if (rand > 0.0f) {
+        Fill_Random_Floats(values, count, base, base + rand);
+    }
+    else {
+        std::fill(values, values + count, base);
+    }
+}
+
 void cParticle_Emitter::Emit(void)
 {
-    if (!m_image) {
+    if (!m_image || !m_emitter_quota) {
         return;
     }
 
-    for (unsigned int i = 0; i < m_emitter_quota; i++) {
-        cParticle* particle = new cParticle(this);
+    size_t count = m_emitter_quota;
 
-        // X Position
-        float x = m_pos_x - (m_image->m_w * 0.5f);
-        if (m_rect.m_w > 0.0f) {
-            x += Get_Random_Float(0.0f, m_rect.m_w);
-        }
-        // Y Position
-        float y = m_pos_y - (m_image->m_h * 0.5f);
-        if (m_rect.m_h > 0.0f) {
-            y += Get_Random_Float(0.0f, m_rect.m_h);
-        }
-        // Set Position
-        particle->Set_Pos(x, y, 1);
+    // level of detail
+    if (pActive_Animation_Manager && !editor_enabled) {
+        const float quota = static_cast<float>(m_emitter_quota) * pActive_Animation_Manager->Get_Particle_Quota_Scale(this);
 
-        // Image
-        particle->Set_Image(m_image, 1);
+        // the fraction is emitted randomly to keep the average quota
+        count = static_cast<size_t>(quota);
 
-        // Z position
-        particle->m_pos_z = m_pos_z;
-        if (m_pos_z_rand > 0.0f) {
-            particle->m_pos_z += Get_Random_Float(0.0f, m_pos_z_rand);
+        if (Get_Random_Float(0.0f, 1.0f, RANDOM_STREAM_PARTICLES) < quota - static_cast<float>(count)) {
+            count++;
         }
 
-        // angle range
-        float dir_angle = m_angle_start;
-        // start angle
-        if (m_angle_range > 0.0f) {
-            dir_angle += Get_Random_Float(0.0f, m_angle_range);
+        if (!count) {
+            return;
         }
+    }
 
-        // Velocity
-        float speed = m_vel;
-        if (m_vel_rand > 0.0f) {
-            speed += Get_Random_Float(0.0f, m_vel_rand);
-        }
-        // Set Velocity
-        particle->Set_Velocity_From_Angle(dir_angle, speed, 1);
+    const size_t first = m_particles.Size();
+
+    m_particles.Resize(first + count);
+
+    // Position
+    Fill_Particle_Values(&m_particles.m_pos_x[first], count, m_pos_x - (m_image->m_w * 0.5f), m_rect.m_w);
+    Fill_Particle_Values(&m_particles.m_pos_y[first], count, m_pos_y - (m_image->m_h * 0.5f), m_rect.m_h);
+    Fill_Particle_Values(&m_particles.m_pos_z[first], count, m_pos_z, m_pos_z_rand);
+
+    // Start rotation
+    std::fill(&m_particles.m_rot_x[first], &m_particles.m_rot_x[first] + count, m_start_rot_x);
+    std::fill(&m_particles.m_rot_y[first], &m_particles.m_rot_y[first] + count, m_start_rot_y);
+    std::fill(&m_particles.m_rot_z[first], &m_particles.m_rot_z[first] + count, m_start_rot_z);
 
-        // Start rotation
-        particle->m_rot_x = m_start_rot_x;
-        particle->m_rot_y = m_start_rot_y;
-        particle->m_rot_z = m_start_rot_z;
+    // Velocity from the direction angle and speed
+    float* vel_x = &m_particles.m_vel_x[first];
+    float* vel_y = &m_particles.m_vel_y[first];
+    float* rot_z = &m_particles.m_rot_z[first];
+
+    Fill_Particle_Values(vel_x, count, m_angle_start, m_angle_range);
+    Fill_Particle_Values(vel_y, count, m_vel, m_vel_rand);
+
+    for (size_t i = 0; i < count; i++) {
+        const float dir_angle = vel_x[i];
+        const float speed = vel_y[i];
+
+        vel_x[i] = cos(dir_angle * deg_to_rad) * speed;
+        vel_y[i] = sin(dir_angle * deg_to_rad) * speed;
 
         // Start direction is added to the z rotation
         if (m_start_rot_z_uses_direction) {
-            particle->m_rot_z += dir_angle;
+            rot_z[i] += dir_angle;
         }
+    }
 
-        // Constant rotation
-        particle->m_const_rot_x = m_const_rot_x;
-        particle->m_const_rot_y = m_const_rot_y;
-        particle->m_const_rot_z = m_const_rot_z;
-        if (m_const_rot_x_rand > 0.0f) {
-            particle->m_const_rot_x += Get_Random_Float(0.0f, m_const_rot_x_rand);
-        }
-        if (m_const_rot_y_rand > 0.0f) {
-            particle->m_const_rot_y += Get_Random_Float(0.0f, m_const_rot_y_rand);
-        }
-        if (m_const_rot_z_rand > 0.0f) {
-            particle->m_const_rot_z += Get_Random_Float(0.0f, m_const_rot_z_rand);
-        }
+    // Constant rotation
+    Fill_Particle_Values(&m_particles.m_const_rot_x[first], count, m_const_rot_x, m_const_rot_x_rand);
+    Fill_Particle_Values(&m_particles.m_const_rot_y[first], count, m_const_rot_y, m_const_rot_y_rand);
+    Fill_Particle_Values(&m_particles.m_const_rot_z[first], count, m_const_rot_z, m_const_rot_z_rand);
 
-        // Scale
-        float scale = m_size_scale;
-        if (m_size_scale_rand > 0.0f) {
-            scale += Get_Random_Float(0.0f, m_size_scale_rand);
-        }
-        particle->Set_Scale(scale, 1);
+    // Scale
+    float* scale = &m_particles.m_scale[first];
+    float* start_scale = &m_particles.m_start_scale[first];
 
-        // Gravity
-        float grav_x = m_gravity_x;
-        if (m_gravity_x_rand > 0.0f) {
-            grav_x += Get_Random_Float(0.0f, m_gravity_x_rand);
-        }
-        float grav_y = m_gravity_y;
-        if (m_gravity_y_rand > 0.0f) {
-            grav_y += Get_Random_Float(0.0f, m_gravity_y_rand);
+    Fill_Particle_Values(scale, count, m_size_scale, m_size_scale_rand);
+
+    for (size_t i = 0; i < count; i++) {
+        // invalid value
+        if (Is_Float_Equal(scale[i], 0.0f)) {
+            scale[i] = 1.0f;
         }
-        // set Gravity
-        particle->Set_Gravity(grav_x, grav_y);
 
-        // Color
-        particle->Set_Color(m_color);
+        start_scale[i] = scale[i];
+    }
+
+    // Gravity
+    Fill_Particle_Values(&m_particles.m_gravity_x[first], count, m_gravity_x, m_gravity_x_rand);
+    Fill_Particle_Values(&m_particles.m_gravity_y[first], count, m_gravity_y, m_gravity_y_rand);
+
+    // Color
+    cRandom& random = Get_Random_Stream(RANDOM_STREAM_PARTICLES);
+    Color* color = &m_particles.m_color[first];
+
+    for (size_t i = 0; i < count; i++) {
+        color[i] = m_color;
+
         if (m_color_rand.red > 0) {
-            particle->m_color.red += rand() % m_color_rand.red;
+            color[i].red += random.Get_Int(m_color_rand.red);
         }
         if (m_color_rand.green > 0) {
-            particle->m_color.green += rand() % m_color_rand.green;
+            color[i].green += random.Get_Int(m_color_rand.green);
         }
         if (m_color_rand.blue > 0) {
-            particle->m_color.blue += rand() % m_color_rand.blue;
+            color[i].blue += random.Get_Int(m_color_rand.blue);
         }
         if (m_color_rand.alpha > 0) {
-            particle->m_color.alpha += rand() % m_color_rand.alpha;
+            color[i].alpha += random.Get_Int(m_color_rand.alpha);
         }
-
-        // Time to life
-        particle->m_time_to_live = m_time_to_live;
-        if (m_time_to_live_rand > 0.0f) {
-            particle->m_time_to_live += Get_Random_Float(0.0f, m_time_to_live_rand);
-        }
-
-        m_objects.push_back(particle);
     }
+
+    // Time to life
+    Fill_Particle_Values(&m_particles.m_time_to_live[first], count, m_time_to_live, m_time_to_live_rand);
 }
 
 void cParticle_Emitter::Clear(bool reset /* = 1 */)
 {
     // clear particles
-    for (ParticleList::iterator itr = m_objects.begin(); itr != m_objects.end(); ++itr) {
-        delete *itr;
-    }
-
-    m_objects.clear();
+    m_particles.Clear();
 
     // clear animation data
     m_emit_counter = 0.0f;
@@ -899,29 +879,90 @@ void cParticle_Emitter::Update(void)
 
     Update_Position();
 
+    // distant emitters are updated less often with a bigger time step
+    m_lod_speed_factor += pFramerate->m_speed_factor;
+
+    if (!editor_enabled && Get_Camera_Distance() > static_cast<float>(game_res_w) && ++m_lod_skipped_frames < 4) {
+        // still counted in the budget
+        if (pActive_Animation_Manager) {
+            pActive_Animation_Manager->Add_Particle_Count(m_particles.Size());
+        }
+
+        return;
+    }
+
+    const float old_speedfactor = pFramerate->m_speed_factor;
+    pFramerate->m_speed_factor = m_lod_speed_factor;
+
     m_emitter_living_time += pFramerate->m_speed_factor * (static_cast<float>(speedfactor_fps) * 0.001f);
 
     Update_Particles();
+
+    pFramerate->m_speed_factor = old_speedfactor;
+    m_lod_speed_factor = 0.0f;
+    m_lod_skipped_frames = 0;
 }
 
 void cParticle_Emitter::Update_Particles(void)
 {
-    // update objects
-    for (ParticleList::iterator itr = m_objects.begin(); itr != m_objects.end();) {
-        // get object pointer
-        cParticle* obj = (*itr);
-
-        // update
-        obj->Update();
+    const size_t count = m_particles.Size();
+
+    if (count) {
+        const float speed_factor = pFramerate->m_speed_factor;
+        const float fade_speed = (static_cast<float>(speedfactor_fps) * 0.001f) * speed_factor;
+
+        float* pos_x = &m_particles.m_pos_x[0];
+        float* pos_y = &m_particles.m_pos_y[0];
+        float* vel_x = &m_particles.m_vel_x[0];
+        float* vel_y = &m_particles.m_vel_y[0];
+        const float* gravity_x = &m_particles.m_gravity_x[0];
+        const float* gravity_y = &m_particles.m_gravity_y[0];
+        float* rot_x = &m_particles.m_rot_x[0];
+        float* rot_y = &m_particles.m_rot_y[0];
+        float* rot_z = &m_particles.m_rot_z[0];
+        const float* const_rot_x = &m_particles.m_const_rot_x[0];
+        const float* const_rot_y = &m_particles.m_const_rot_y[0];
+        const float* const_rot_z = &m_particles.m_const_rot_z[0];
+        float* scale = &m_particles.m_scale[0];
+        const float* start_scale = &m_particles.m_start_scale[0];
+        const float* time_to_live = &m_particles.m_time_to_live[0];
+        float* fade_pos = &m_particles.m_fade_pos[0];
+
+        // fade, move and rotate without branches so the compiler can vectorize it
+        for (size_t i = 0; i < count; i++) {
+            fade_pos[i] -= fade_speed / time_to_live[i];
+
+            // move
+            pos_x[i] += vel_x[i] * speed_factor;
+            pos_y[i] += vel_y[i] * speed_factor;
+            // todo : gravity maximum
+            vel_x[i] += gravity_x[i] * speed_factor;
+            vel_y[i] += gravity_y[i] * speed_factor;
+
+            // constant rotation kept in the range of fmod
+            rot_x[i] += const_rot_x[i] * speed_factor;
+            rot_x[i] -= 360.0f * static_cast<int>(rot_x[i] * (1.0f / 360.0f));
+            rot_y[i] += const_rot_y[i] * speed_factor;
+            rot_y[i] -= 360.0f * static_cast<int>(rot_y[i] * (1.0f / 360.0f));
+            rot_z[i] += const_rot_z[i] * speed_factor;
+            rot_z[i] -= 360.0f * static_cast<int>(rot_z[i] * (1.0f / 360.0f));
+        }
 
-        // if finished
-        if (!obj->m_active) {
-            itr = m_objects.erase(itr);
-            delete obj;
+        // with size fading
+        if (m_fade_size) {
+            for (size_t i = 0; i < count; i++) {
+                scale[i] = start_scale[i] * fade_pos[i];
+            }
         }
-        // increment
-        else {
-            ++itr;
+
+        // remove finished particles
+        for (size_t i = 0; i < m_particles.Size();) {
+            if (m_particles.m_fade_pos[i] <= 0.0f) {
+                m_particles.Remove(i);
+            }
+            else {
+                i++;
+            }
         }
     }
 
@@ -936,9 +977,13 @@ void cParticle_Emitter::Update_Particles(void)
         m_emit_counter += pFramerate->m_speed_factor * (static_cast<float>(speedfactor_fps) * 0.001f);
     }
     // no particles are active
-    else if (m_objects.empty()) {
+    else if (m_particles.Empty()) {
         Set_Active(0);
     }
+
+    if (pActive_Animation_Manager) {
+        pActive_Animation_Manager->Add_Particle_Count(m_particles.Size());
+    }
 }
 
 void cParticle_Emitter::Update_Position(void)
@@ -979,8 +1024,16 @@ void cParticle_Emitter::Draw(cSurface_Request* request /* = NULL */)
         return;
     }
 
-    for (ParticleList::iterator itr = m_objects.begin(); itr != m_objects.end(); ++itr) {
-        (*itr)->Draw();
+    if (m_image && !m_particles.Empty()) {
+        // particles on the same z position can not be between other objects
+        if (m_pos_z_rand <= 0.0f) {
+            Draw_Particles_Array();
+        }
+        else {
+            for (size_t i = 0; i < m_particles.Size(); i++) {
+                Draw_Particle(i);
+            }
+        }
     }
 
     if (editor_enabled) {
@@ -988,7 +1041,7 @@ void cParticle_Emitter::Draw(cSurface_Request* request /* = NULL */)
             // draw emitter rect
             GL_rect color_rect = GL_rect(m_start_pos_x - pActive_Camera->m_x, m_start_pos_y - pActive_Camera->m_y, m_col_rect.m_w, m_col_rect.m_h);
 
-            cRect_Request* rect_request = new cRect_Request();
+            cRect_Request* rect_request = pRenderer->Alloc<cRect_Request>();
             pVideo->Draw_Rect(&color_rect, m_editor_pos_z, &darkgreen, rect_request);
             rect_request->m_filled = 0;
             pRenderer->Add(rect_request);
@@ -999,7 +1052,7 @@ void cParticle_Emitter::Draw(cSurface_Request* request /* = NULL */)
                 if (m_clip_rect.m_w > 0.0f && m_clip_rect.m_h > 0.0f) {
                     color_rect = GL_rect(m_start_pos_x + m_clip_rect.m_x - pActive_Camera->m_x, m_start_pos_y + m_clip_rect.m_y - pActive_Camera->m_y, m_clip_rect.m_w, m_clip_rect.m_h);
 
-                    rect_request = new cRect_Request();
+                    rect_request = pRenderer->Alloc<cRect_Request>();
                     pVideo->Draw_Rect(&color_rect, m_editor_pos_z, &lightgrey, rect_request);
                     rect_request->m_filled = 0;
                     rect_request->m_line_width = 2.0f;
@@ -1010,98 +1063,250 @@ void cParticle_Emitter::Draw(cSurface_Request* request /* = NULL */)
     }
 }
 
+void cParticle_Emitter::Draw_Particle(size_t index)
+{
+    cSurface_Request* request = pRenderer->Alloc<cSurface_Request>();
+
+    const float scale = m_particles.m_scale[index];
+
+    // texture id
+    request->m_texture_id = m_image->m_image;
+    request->m_tex_rect = m_image->m_tex_rect;
+
+    // size
+    request->m_w = m_image->m_start_w;
+    request->m_h = m_image->m_start_h;
+
+    // rotation
+    request->m_rot_x = m_particles.m_rot_x[index] + m_image->m_base_rot_x;
+    request->m_rot_y = m_particles.m_rot_y[index] + m_image->m_base_rot_y;
+    request->m_rot_z = m_particles.m_rot_z[index] + m_image->m_base_rot_z;
+
+    // position with centered scale
+    if (scale != 1.0f) {
+        request->m_scale_x = scale;
+        request->m_scale_y = scale;
+        request->m_pos_x = m_particles.m_pos_x[index] + (m_image->m_int_x * scale) - ((m_image->m_w * 0.5f) * (scale - 1.0f));
+        request->m_pos_y = m_particles.m_pos_y[index] + (m_image->m_int_y * scale) - ((m_image->m_h * 0.5f) * (scale - 1.0f));
+    }
+    else {
+        request->m_pos_x = m_particles.m_pos_x[index] + m_image->m_int_x;
+        request->m_pos_y = m_particles.m_pos_y[index] + m_image->m_int_y;
+    }
+
+    request->m_pos_z = m_particles.m_pos_z[index];
+    // particles are drawn relative to the camera like the array request
+    request->m_no_camera = 0;
+
+    // based on emitter position
+    if (m_particle_based_on_emitter_pos > 0.0f) {
+        request->m_pos_x += (m_pos_x * m_particle_based_on_emitter_pos);
+        request->m_pos_y += (m_pos_y * m_particle_based_on_emitter_pos);
+    }
+
+    Set_Particle_Blending(request);
+    request->m_color = Get_Particle_Color(index);
+
+    // add request
+    pRenderer->Add(request);
+}
+
+void cParticle_Emitter::Draw_Particles_Array(void)
+{
+    cSurface_Array_Request* request = pRenderer->Alloc<cSurface_Array_Request>();
+
+    // texture id
+    request->m_texture_id = m_image->m_image;
+    Set_Particle_Blending(request);
+
+    float offset_x = 0.0f;
+    float offset_y = 0.0f;
+
+    // based on emitter position
+    if (m_particle_based_on_emitter_pos > 0.0f) {
+        offset_x = m_pos_x * m_particle_based_on_emitter_pos;
+        offset_y = m_pos_y * m_particle_based_on_emitter_pos;
+    }
+
+    const size_t count = m_particles.Size();
+    // sorted with the lowest particle z position
+    float pos_z = m_particles.m_pos_z[0];
+
+    request->m_vertices.reserve(count * 4);
+
+    for (size_t i = 0; i < count; i++) {
+        const float scale = m_particles.m_scale[i];
+
+        // position with centered scale
+        const float pos_x = m_particles.m_pos_x[i] + offset_x + (m_image->m_int_x * scale) - ((m_image->m_w * 0.5f) * (scale - 1.0f));
+        const float pos_y = m_particles.m_pos_y[i] + offset_y + (m_image->m_int_y * scale) - ((m_image->m_h * 0.5f) * (scale - 1.0f));
+
+        if (m_particles.m_pos_z[i] < pos_z) {
+            pos_z = m_particles.m_pos_z[i];
+        }
+
+        request->Add(pos_x, pos_y, m_particles.m_pos_z[i], m_image->m_start_w, m_image->m_start_h, scale, m_particles.m_rot_x[i] + m_image->m_base_rot_x, m_particles.m_rot_y[i] + m_image->m_base_rot_y, m_particles.m_rot_z[i] + m_image->m_base_rot_z, m_image->m_tex_rect, Get_Particle_Color(i));
+    }
+
+    request->m_pos_z = pos_z;
+
+    // add request
+    pRenderer->Add(request);
+}
+
+void cParticle_Emitter::Set_Particle_Blending(cRender_Request_Advanced* request) const
+{
+    if (m_blending == BLEND_ADD) {
+        request->m_blend_sfactor = GL_SRC_ALPHA;
+        request->m_blend_dfactor = GL_ONE;
+    }
+    else if (m_blending == BLEND_DRIVE) {
+        request->m_blend_sfactor = GL_SRC_COLOR;
+        request->m_blend_dfactor = GL_DST_ALPHA;
+    }
+}
+
+Color cParticle_Emitter::Get_Particle_Color(size_t index) const
+{
+    Color color = m_particles.m_color[index];
+    const float fade_pos = m_particles.m_fade_pos[index];
+
+    // color fading
+    if (m_fade_color) {
+        color.red = static_cast<uint8_t>(color.red * fade_pos);
+        color.green = static_cast<uint8_t>(color.green * fade_pos);
+        color.blue = static_cast<uint8_t>(color.blue * fade_pos);
+    }
+
+    // alpha fading
+    if (m_fade_alpha) {
+        color.alpha = static_cast<uint8_t>(color.alpha * fade_pos);
+    }
+
+    return color;
+}
+
 void cParticle_Emitter::Keep_Particles_In_Rect(const GL_rect& clip_rect, ParticleClipMode mode /* = PCM_MOVE */)
 {
+    if (!m_image) {
+        return;
+    }
+
     // temporary obj rect
     GL_rect obj_rect;
 
     // find particles that are not visible and move them to the opposite screen side
-    for (ParticleList::iterator itr = m_objects.begin(); itr != m_objects.end(); ++itr) {
-        // get animation particle pointer
-        cParticle* obj = static_cast<cParticle*>(*itr);
+    for (size_t i = 0; i < m_particles.Size();) {
+        const float scale = m_particles.m_scale[i];
+        float& pos_x = m_particles.m_pos_x[i];
+        float& pos_y = m_particles.m_pos_y[i];
+        float& vel_x = m_particles.m_vel_x[i];
+        float& vel_y = m_particles.m_vel_y[i];
 
         // set rectangle
-        if (obj->m_scale_x != 1.0f) {
-            obj_rect.m_x = obj->m_pos_x - ((obj->m_image->m_w * 0.5f) * (obj->m_scale_x - 1.0f));
-            obj_rect.m_w = obj->m_rect.m_w * obj->m_scale_x;
+        if (scale != 1.0f) {
+            obj_rect.m_x = pos_x - ((m_image->m_w * 0.5f) * (scale - 1.0f));
+            obj_rect.m_w = m_image->m_w * scale;
+            obj_rect.m_y = pos_y - ((m_image->m_h * 0.5f) * (scale - 1.0f));
+            obj_rect.m_h = m_image->m_h * scale;
         }
         else {
-            obj_rect.m_x = obj->m_pos_x;
-            obj_rect.m_w = obj->m_rect.m_w;
+            obj_rect.m_x = pos_x;
+            obj_rect.m_w = m_image->m_w;
+            obj_rect.m_y = pos_y;
+            obj_rect.m_h = m_image->m_h;
         }
 
-        if (obj->m_scale_y != 1.0f) {
-            obj_rect.m_y = obj->m_pos_y - ((obj->m_image->m_h * 0.5f) * (obj->m_scale_y - 1.0f));
-            obj_rect.m_h = obj->m_rect.m_h * obj->m_scale_y;
-        }
-        else {
-            obj_rect.m_y = obj->m_pos_y;
-            obj_rect.m_h = obj->m_rect.m_h;
-        }
+        bool outside = 1;
 
         // out in left
         if (obj_rect.m_x + obj_rect.m_w < clip_rect.m_x) {
             // move to right
             if (mode == PCM_MOVE) {
-                obj->Move(clip_rect.m_w + obj_rect.m_w - 1.0f, 0, 1);
+                pos_x += clip_rect.m_w + obj_rect.m_w - 1.0f;
             }
             else if (mode == PCM_REVERSE) {
-                if (obj->m_velx < 0.0f) {
-                    obj->Set_Velocity(-obj->m_velx, obj->m_vely);
+                if (vel_x < 0.0f) {
+                    vel_x = -vel_x;
                 }
             }
-            else if (mode == PCM_DELETE) {
-                obj->Set_Active(0);
-            }
         }
         // out in right
         else if (obj_rect.m_x > clip_rect.m_x + clip_rect.m_w) {
             // move to left
             if (mode == PCM_MOVE) {
-                obj->Move(-clip_rect.m_w - obj_rect.m_w + 1.0f, 0, 1);
+                pos_x += -clip_rect.m_w - obj_rect.m_w + 1.0f;
             }
             else if (mode == PCM_REVERSE) {
-                if (obj->m_velx > 0.0f) {
-                    obj->Set_Velocity(-obj->m_velx, obj->m_vely);
+                if (vel_x > 0.0f) {
+                    vel_x = -vel_x;
                 }
             }
-            else if (mode == PCM_DELETE) {
-                obj->Set_Active(0);
-            }
         }
         // out on top
         else if (obj_rect.m_y + obj_rect.m_h < clip_rect.m_y) {
             // move to bottom
             if (mode == PCM_MOVE) {
-                obj->Move(0, clip_rect.m_h + obj_rect.m_h - 1.0f, 1);
+                pos_y += clip_rect.m_h + obj_rect.m_h - 1.0f;
             }
             else if (mode == PCM_REVERSE) {
-                if (obj->m_vely < 0.0f) {
-                    obj->Set_Velocity(obj->m_velx, -obj->m_vely);
+                if (vel_y < 0.0f) {
+                    vel_y = -vel_y;
                 }
             }
-            else if (mode == PCM_DELETE) {
-                obj->Set_Active(0);
-            }
         }
         // out on bottom
         else if (obj_rect.m_y > clip_rect.m_y + clip_rect.m_h) {
             // move to top
             if (mode == PCM_MOVE) {
-                obj->Move(0, -clip_rect.m_h - obj_rect.m_h + 1.0f, 1);
+                pos_y += -clip_rect.m_h - obj_rect.m_h + 1.0f;
             }
             else if (mode == PCM_REVERSE) {
-                if (obj->m_vely > 0.0f) {
-                    obj->Set_Velocity(obj->m_velx, -obj->m_vely);
+                if (vel_y > 0.0f) {
+                    vel_y = -vel_y;
                 }
             }
-            else if (mode == PCM_DELETE) {
-                obj->Set_Active(0);
-            }
+        }
+        else {
+            outside = 0;
+        }
+
+        if (outside && mode == PCM_DELETE) {
+            m_particles.Remove(i);
+        }
+        else {
+            i++;
         }
     }
 }
 
+float cParticle_Emitter::Get_Camera_Distance(void) const
+{
+    if (m_emitter_based_on_camera_pos) {
+        return 0.0f;
+    }
+
+    float distance_x = 0.0f;
+    float distance_y = 0.0f;
+
+    // left or right of the screen
+    if (m_pos_x + m_rect.m_w < pActive_Camera->m_x) {
+        distance_x = pActive_Camera->m_x - (m_pos_x + m_rect.m_w);
+    }
+    else if (m_pos_x > pActive_Camera->m_x + game_res_w) {
+        distance_x = m_pos_x - (pActive_Camera->m_x + game_res_w);
+    }
+    // above or below the screen
+    if (m_pos_y + m_rect.m_h < pActive_Camera->m_y) {
+        distance_y = pActive_Camera->m_y - (m_pos_y + m_rect.m_h);
+    }
+    else if (m_pos_y > pActive_Camera->m_y + game_res_h) {
+        distance_y = m_pos_y - (pActive_Camera->m_y + game_res_h);
+    }
+
+    return distance_x > distance_y ? distance_x : distance_y;
+}
+
 bool cParticle_Emitter::Is_Update_Valid()
 {
     // if not active
@@ -1181,6 +1386,8 @@ void cParticle_Emitter::Set_Spawned(bool enable /* = 0 */)
 void cParticle_Emitter::Set_Based_On_Camera_Pos(bool enable)
 {
     m_emitter_based_on_camera_pos = enable;
+    // the position is relative to the camera
+    Set_Always_Active(enable);
 }
 
 void cParticle_Emitter::Set_Particle_Based_On_Emitter_Pos(float val)
@@ -2111,7 +2318,9 @@ bool cParticle_Emitter::Editor_Clip_Mode_Select(const CEGUI::EventArgs& event)
 cAnimation_Manager::cAnimation_Manager(void)
     : cObject_Manager<cAnimation>()
 {
-
+    m_particle_budget = 20000;
+    m_particle_count = 0;
+    m_particle_count_frame = 0;
 }
 
 cAnimation_Manager::~cAnimation_Manager(void)
@@ -2121,23 +2330,53 @@ cAnimation_Manager::~cAnimation_Manager(void)
 
 void cAnimation_Manager::Update(void)
 {
-    for (cAnimation_List::iterator itr = objects.begin(); itr != objects.end();) {
+    // a new frame
+    m_particle_count = m_particle_count_frame;
+    m_particle_count_frame = 0;
+
+    // by index as updates can add animations
+    for (size_t i = 0; i < objects.size(); i++) {
         // get object pointer
-        cAnimation* obj = (*itr);
+        cAnimation* obj = objects[i];
+
+        // deleted
+        if (obj->m_manager_entry.m_deleted) {
+            continue;
+        }
 
         // update
         obj->Update();
 
         // delete if finished
         if (!obj->m_active) {
-            itr = objects.erase(itr);
-            delete obj;
-        }
-        // increment
-        else {
-            ++itr;
+            Delete(obj);
         }
     }
+
+    // remove the finished animations at once
+    Compact();
+}
+
+float cAnimation_Manager::Get_Particle_Quota_Scale(const cParticle_Emitter* emitter) const
+{
+    float scale = 1.0f;
+
+    // distant emitters
+    const float distance = emitter->Get_Camera_Distance();
+
+    if (distance > static_cast<float>(game_res_w)) {
+        scale = 0.25f;
+    }
+    else if (distance > static_cast<float>(game_res_w) * 0.5f) {
+        scale = 0.5f;
+    }
+
+    // over budget
+    if (m_particle_count > m_particle_budget) {
+        scale *= static_cast<float>(m_particle_budget) / static_cast<float>(m_particle_count);
+    }
+
+    return scale;
 }
 
 void cAnimation_Manager::Draw(void)
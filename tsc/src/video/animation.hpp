@@ -116,39 +116,60 @@ namespace TSC {
         FireAnimList m_objects;
     };
 
-    /* *** *** *** *** *** *** *** Particle Emitter item *** *** *** *** *** *** *** *** *** *** */
+    /* *** *** *** *** *** *** *** Particle Store *** *** *** *** *** *** *** *** *** *** */
 
-// forward declare
-    class cParticle_Emitter;
-
-// Particle Item
-    class cParticle : public cMovingSprite {
+/* Particles of an emitter stored as structure of arrays
+ * a removed particle is replaced by the last one
+*/
+    class cParticle_Store {
     public:
-        cParticle(cParticle_Emitter* parent);
-        virtual ~cParticle(void);
-
-        // update
-        virtual void Update(void);
-        // draw
-        virtual void Draw(cSurface_Request* request = NULL);
-
-        // set gravity
-        void Set_Gravity(float x, float y);
+        /* Change the particle count
+         * new particles get default values
+        */
+        void Resize(size_t count);
+        // Remove the particle by moving the last particle into its place
+        void Remove(size_t index);
+        // Remove all particles
+        void Clear(void);
+
+        // Return the particle count
+        inline size_t Size(void) const
+        {
+            return m_fade_pos.size();
+        }
+        // Return true if no particle exists
+        inline bool Empty(void) const
+        {
+            return m_fade_pos.empty();
+        }
 
-        // parent particle emitter
-        cParticle_Emitter* m_parent;
-        // time to live
-        float m_time_to_live;
+        // position
+        vector<float> m_pos_x;
+        vector<float> m_pos_y;
+        vector<float> m_pos_z;
+        // velocity
+        vector<float> m_vel_x;
+        vector<float> m_vel_y;
+        // gravity
+        vector<float> m_gravity_x;
+        vector<float> m_gravity_y;
+        // rotation
+        vector<float> m_rot_x;
+        vector<float> m_rot_y;
+        vector<float> m_rot_z;
         // constant rotation
-        float m_const_rot_x;
-        float m_const_rot_y;
-        float m_const_rot_z;
-        // particle gravity
-        float m_gravity_x;
-        float m_gravity_y;
-
+        vector<float> m_const_rot_x;
+        vector<float> m_const_rot_y;
+        vector<float> m_const_rot_z;
+        // scale
+        vector<float> m_scale;
+        vector<float> m_start_scale;
+        // time to live
+        vector<float> m_time_to_live;
         // fading position value
-        float m_fade_pos;
+        vector<float> m_fade_pos;
+        // color
+        vector<Color> m_color;
     };
 
     /* *** *** *** *** *** *** *** Particle Emitter *** *** *** *** *** *** *** *** *** *** */
@@ -199,6 +220,11 @@ namespace TSC {
         // Draw everything
         virtual void Draw(cSurface_Request* request = NULL);
 
+        /* Return the distance between the emitter and the visible screen area
+         * 0 if based on the camera position or visible
+        */
+        float Get_Camera_Distance(void) const;
+
         // keep particles in the given rectangle
         void Keep_Particles_In_Rect(const GL_rect& clip_rect, ParticleClipMode mode = PCM_MOVE);
 
@@ -311,8 +337,7 @@ namespace TSC {
         bool Editor_Clip_Mode_Select(const CEGUI::EventArgs& event);
 
         // Particle items
-        typedef vector<cParticle*> ParticleList;
-        ParticleList m_objects;
+        cParticle_Store m_particles;
 
         // filename of the particle image
         boost::filesystem::path m_image_filename;
@@ -372,10 +397,23 @@ namespace TSC {
         virtual std::string Get_XML_Type_Name();
 
     private:
+        // Draw the particle with the given index as a single request
+        void Draw_Particle(size_t index);
+        // Draw all particles as one vertex array request
+        void Draw_Particles_Array(void);
+        // Set the blend factors of the blending mode
+        void Set_Particle_Blending(cRender_Request_Advanced* request) const;
+        // Return the particle color with fading applied
+        Color Get_Particle_Color(size_t index) const;
+
         // time alive
         float m_emitter_living_time;
         // emit counter
         float m_emit_counter;
+        // speed factor collected while distant update frames are skipped
+        float m_lod_speed_factor;
+        // skipped distant update frames
+        unsigned int m_lod_skipped_frames;
     };
 
     /* *** *** *** *** *** *** *** Animation Manager *** *** *** *** *** *** *** *** *** *** */
@@ -393,7 +431,32 @@ namespace TSC {
         // Draw the objects
         void Draw(void);
 
+        /* Return the factor for the emit quota of the emitter
+         * reduced for distant emitters and if the particle budget is exceeded
+        */
+        float Get_Particle_Quota_Scale(const cParticle_Emitter* emitter) const;
+        // Add to the particle count of the current frame
+        inline void Add_Particle_Count(size_t count)
+        {
+            m_particle_count_frame += static_cast<unsigned int>(count);
+        }
+
         typedef vector<cAnimation*> cAnimation_List;
+
+        // particle count of all emitters before the quota is reduced
+        unsigned int m_particle_budget;
+        // particle count of all emitters in the last frame
+        unsigned int m_particle_count;
+
+    protected:
+        virtual cObject_Manager_Entry* Get_Entry(cAnimation* obj) const
+        {
+            return &obj->m_manager_entry;
+        }
+
+    private:
+        // particle count of the current frame
+        unsigned int m_particle_count_frame;
     };
 
     /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
@@ -0,0 +1,187 @@
+/***************************************************************************
+ * gl_state.cpp  -  OpenGL state cache for the renderer
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "../video/gl_state.hpp"
+
+namespace TSC {
+
+/* *** *** *** *** *** *** cGL_State *** *** *** *** *** *** *** *** *** *** *** */
+
+cGL_State::cGL_State(void)
+{
+    m_avoided_changes = 0;
+    m_done_changes = 0;
+
+    m_known = 0;
+
+    m_caps[0] = 0;
+    m_caps[1] = 0;
+    m_texture_id = 0;
+    m_blend_sfactor = GL_SRC_ALPHA;
+    m_blend_dfactor = GL_ONE_MINUS_SRC_ALPHA;
+    m_combine_type = 0;
+    m_combine_color[0] = 0.0f;
+    m_combine_color[1] = 0.0f;
+    m_combine_color[2] = 0.0f;
+    m_color = static_cast<uint8_t>(255);
+    m_line_width = 1.0f;
+
+    m_frame_avoided = 0;
+    m_frame_done = 0;
+}
+
+void cGL_State::Start_Frame(void)
+{
+    m_known = 0;
+
+    m_avoided_changes = m_frame_avoided;
+    m_done_changes = m_frame_done;
+    m_frame_avoided = 0;
+    m_frame_done = 0;
+}
+
+void cGL_State::Restore_Defaults(void)
+{
+    Set_Blend_Func(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    Set_Combine(0, NULL);
+    Set_Color(white);
+    Set_Line_Width(1.0f);
+    Set_Enabled(GL_LINE_STIPPLE, 0);
+}
+
+int cGL_State::Get_Cap_Index(GLenum cap)
+{
+    if (cap == GL_TEXTURE_2D) {
+        return 0;
+    }
+    if (cap == GL_LINE_STIPPLE) {
+        return 1;
+    }
+
+    return -1;
+}
+
+void cGL_State::Set_Enabled(GLenum cap, bool enable)
+{
+    const int index = Get_Cap_Index(cap);
+
+    if (index >= 0) {
+        if (Is_Unchanged(index ? STATE_CAPS_STIPPLE : STATE_CAPS_2D, m_caps[index] == enable)) {
+            return;
+        }
+
+        m_caps[index] = enable;
+    }
+
+    if (enable) {
+        glEnable(cap);
+    }
+    else {
+        glDisable(cap);
+    }
+}
+
+void cGL_State::Bind_Texture(GLuint texture_id)
+{
+    if (Is_Unchanged(STATE_TEXTURE, m_texture_id == texture_id)) {
+        return;
+    }
+
+    m_texture_id = texture_id;
+    glBindTexture(GL_TEXTURE_2D, texture_id);
+}
+
+void cGL_State::Set_Blend_Func(GLenum sfactor, GLenum dfactor)
+{
+    if (Is_Unchanged(STATE_BLEND, m_blend_sfactor == sfactor && m_blend_dfactor == dfactor)) {
+        return;
+    }
+
+    m_blend_sfactor = sfactor;
+    m_blend_dfactor = dfactor;
+    glBlendFunc(sfactor, dfactor);
+}
+
+void cGL_State::Set_Combine(GLint combine_type, const float* combine_color)
+{
+    bool same = m_combine_type == combine_type;
+
+    // the color is only used if combining
+    if (same && combine_type != 0) {
+        same = m_combine_color[0] == combine_color[0] && m_combine_color[1] == combine_color[1] && m_combine_color[2] == combine_color[2];
+    }
+
+    if (Is_Unchanged(STATE_COMBINE, same)) {
+        return;
+    }
+
+    m_combine_type = combine_type;
+
+    // Color Combine
+    if (combine_type != 0) {
+        m_combine_color[0] = combine_color[0];
+        m_combine_color[1] = combine_color[1];
+        m_combine_color[2] = combine_color[2];
+
+        glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_COMBINE);
+        glTexEnvi(GL_TEXTURE_ENV, GL_COMBINE_RGB, combine_type);
+        glTexEnvi(GL_TEXTURE_ENV, GL_SOURCE0_RGB, GL_CONSTANT);
+        glTexEnvfv(GL_TEXTURE_ENV, GL_TEXTURE_ENV_COLOR, m_combine_color);
+        glTexEnvi(GL_TEXTURE_ENV, GL_SOURCE1_RGB, GL_TEXTURE);
+    }
+    // clear color modifications
+    else {
+        m_combine_color[0] = 0.0f;
+        m_combine_color[1] = 0.0f;
+        m_combine_color[2] = 0.0f;
+
+        glTexEnvfv(GL_TEXTURE_ENV, GL_TEXTURE_ENV_COLOR, m_combine_color);
+        glTexEnvi(GL_TEXTURE_ENV, GL_COMBINE_RGB, GL_MODULATE);
+        glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
+    }
+}
+
+void cGL_State::Set_Color(const Color& color)
+{
+    if (Is_Unchanged(STATE_COLOR, m_color == color)) {
+        return;
+    }
+
+    m_color = color;
+    glColor4ub(color.red, color.green, color.blue, color.alpha);
+}
+
+void cGL_State::Set_Line_Width(float width)
+{
+    if (Is_Unchanged(STATE_LINE_WIDTH, m_line_width == width)) {
+        return;
+    }
+
+    m_line_width = width;
+    glLineWidth(width);
+}
+
+void cGL_State::Invalidate_Color(void)
+{
+    m_known &= ~STATE_COLOR;
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+cGL_State* pGL_State = NULL;
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
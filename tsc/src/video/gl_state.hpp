@@ -0,0 +1,118 @@
+/***************************************************************************
+ * gl_state.hpp  -  OpenGL state cache for the renderer
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TSC_GL_STATE_HPP
+#define TSC_GL_STATE_HPP
+
+#include "../core/global_basic.hpp"
+#include "../video/video.hpp"
+
+namespace TSC {
+
+    /* *** *** *** *** *** *** cGL_State *** *** *** *** *** *** *** *** *** *** *** */
+
+    /* Remembers the OpenGL state set by the render requests
+     * and skips calls which would not change it
+     * The state is unknown at the start of every frame as other code
+     * like the GUI renderer uses OpenGL directly.
+    */
+    class cGL_State {
+    public:
+        cGL_State(void);
+
+        /* Forget the known state and start counting for a new frame
+         * must be called before the render requests are drawn
+        */
+        void Start_Frame(void);
+        // Set the default state expected by other OpenGL code
+        void Restore_Defaults(void);
+
+        // Enable or disable GL_TEXTURE_2D or GL_LINE_STIPPLE
+        void Set_Enabled(GLenum cap, bool enable);
+        // Bind the 2D texture
+        void Bind_Texture(GLuint texture_id);
+        // Set the blend factors
+        void Set_Blend_Func(GLenum sfactor, GLenum dfactor);
+        /* Set the texture color combine
+         * if the combine type is 0 the texture is modulated
+        */
+        void Set_Combine(GLint combine_type, const float* combine_color);
+        // Set the current color
+        void Set_Color(const Color& color);
+        // Set the line width
+        void Set_Line_Width(float width);
+        // Forget the current color after it was changed by a color array
+        void Invalidate_Color(void);
+
+        // state changes avoided and done in the last frame
+        unsigned int m_avoided_changes;
+        unsigned int m_done_changes;
+    private:
+        // Return the index of a tracked capability or -1
+        static int Get_Cap_Index(GLenum cap);
+
+        // known state flags
+        enum {
+            STATE_CAPS_2D = 1 << 0,
+            STATE_CAPS_STIPPLE = 1 << 1,
+            STATE_TEXTURE = 1 << 2,
+            STATE_BLEND = 1 << 3,
+            STATE_COMBINE = 1 << 4,
+            STATE_COLOR = 1 << 5,
+            STATE_LINE_WIDTH = 1 << 6
+        };
+
+        /* Return true if the state is known and has the same value
+         * otherwise it is marked as known
+        */
+        inline bool Is_Unchanged(unsigned int state, bool same_value)
+        {
+            if ((m_known & state) && same_value) {
+                m_frame_avoided++;
+                return 1;
+            }
+
+            m_known |= state;
+            m_frame_done++;
+            return 0;
+        }
+
+        // known state flags
+        unsigned int m_known;
+
+        bool m_caps[2];
+        GLuint m_texture_id;
+        GLenum m_blend_sfactor;
+        GLenum m_blend_dfactor;
+        GLint m_combine_type;
+        float m_combine_color[3];
+        Color m_color;
+        float m_line_width;
+
+        // counters of the current frame
+        unsigned int m_frame_avoided;
+        unsigned int m_frame_done;
+    };
+
+    /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+// OpenGL state of the renderer
+    extern cGL_State* pGL_State;
+
+    /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
+
+#endif
@@ -33,6 +33,8 @@ namespace TSC {
 cGL_Surface::cGL_Surface(void)
 {
     m_image = 0;
+    m_tex_rect = GL_rect(0.0f, 0.0f, 1.0f, 1.0f);
+    m_atlas = 0;
 
     m_int_x = 0;
     m_int_y = 0;
@@ -85,6 +87,12 @@ cGL_Surface* cGL_Surface::Copy(void) const
 
     // data
     new_surface->m_image = m_image;
+    new_surface->m_tex_rect = m_tex_rect;
+    new_surface->m_atlas = m_atlas;
+    // the atlas is owned by the image manager
+    if (m_atlas) {
+        new_surface->m_auto_del_img = 0;
+    }
     new_surface->m_int_x = m_int_x;
     new_surface->m_int_y = m_int_y;
     new_surface->m_start_w = m_start_w;
@@ -118,7 +126,7 @@ void cGL_Surface::Blit(float x, float y, float z, cSurface_Request* request /* =
     if (!request) {
         create_request = 1;
         // create request
-        request = new cSurface_Request();
+        request = pRenderer->Alloc<cSurface_Request>();
     }
 
     Blit_Data(request);
@@ -138,6 +146,7 @@ void cGL_Surface::Blit_Data(cSurface_Request* request) const
 {
     // texture id
     request->m_texture_id = m_image;
+    request->m_tex_rect = m_tex_rect;
 
     // position
     request->m_pos_x += m_int_x;
@@ -165,8 +174,30 @@ void cGL_Surface::Save(const std::string& filename)
 
     // create image data
     GLubyte* data = new GLubyte[m_tex_w * m_tex_h * 4];
+
+    // copy our part of the atlas
+    if (m_atlas) {
+        GLint atlas_w = 0;
+        GLint atlas_h = 0;
+        glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_WIDTH, &atlas_w);
+        glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_HEIGHT, &atlas_h);
+
+        GLubyte* atlas_data = new GLubyte[atlas_w * atlas_h * 4];
+        glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, static_cast<GLvoid*>(atlas_data));
+
+        const unsigned int start_x = static_cast<unsigned int>(m_tex_rect.m_x * atlas_w + 0.5f);
+        const unsigned int start_y = static_cast<unsigned int>(m_tex_rect.m_y * atlas_h + 0.5f);
+
+        for (unsigned int y = 0; y < m_tex_h; y++) {
+            memcpy(data + y * m_tex_w * 4, atlas_data + ((start_y + y) * atlas_w + start_x) * 4, m_tex_w * 4);
+        }
+
+        delete[] atlas_data;
+    }
     // read texture
-    glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, static_cast<GLvoid*>(data));
+    else {
+        glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, static_cast<GLvoid*>(data));
+    }
     // save
     pVideo->Save_Surface(filename, data, m_tex_w, m_tex_h);
     // clear data
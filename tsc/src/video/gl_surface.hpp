@@ -19,6 +19,8 @@
 
 #include "../core/global_basic.hpp"
 #include "../core/math/point.hpp"
+#include "../core/math/rect.hpp"
+#include "../core/obj_manager.hpp"
 
 namespace TSC {
 
@@ -67,6 +69,10 @@ namespace TSC {
 
         // GL texture number
         GLuint m_image;
+        // texture coordinates of the image inside the texture
+        GL_rect m_tex_rect;
+        // if set the texture is an atlas shared with other surfaces
+        bool m_atlas;
         // internal drawing offset
         float m_int_x;
         float m_int_y;
@@ -100,6 +106,8 @@ namespace TSC {
         bool m_auto_del_img;
         // if managed over the image manager
         bool m_managed;
+        // position in the image manager
+        cObject_Manager_Entry m_manager_entry;
         // if the image is tagged as obsolete
         bool m_obsolete;
 
@@ -57,6 +57,7 @@ cImage_Manager::cImage_Manager(void)
     : cObject_Manager<cGL_Surface>()
 {
     m_high_texture_id = 0;
+    m_use_atlases = 0;
 }
 
 cImage_Manager::~cImage_Manager(void)
@@ -73,14 +74,17 @@ void cImage_Manager::Add(cGL_Surface* obj)
     // it is now managed
     obj->m_managed = 1;
 
-    // Add and remember index where it was stored
+    // remove deleted surfaces before the array grows
+    Compact();
+
+    // Add and remember the surface for its path
     cObject_Manager<cGL_Surface>::Add(obj);
-    m_index_table[path_to_utf8(obj->m_path)] = objects.size() - 1;
+    m_index_table[path_to_utf8(obj->m_path)] = obj;
 }
 
 cGL_Surface* cImage_Manager::Get_Pointer(const fs::path& path)
 {
-    std::unordered_map<std::string, size_t>::iterator iter =
+    std::unordered_map<std::string, cGL_Surface*>::iterator iter =
         m_index_table.find(path_to_utf8(path));
 
     if (iter == m_index_table.end()) {
@@ -88,13 +92,13 @@ cGL_Surface* cImage_Manager::Get_Pointer(const fs::path& path)
         return NULL;
     }
     else {
-        return objects[iter->second];
+        return iter->second;
     }
 }
 
 cGL_Surface* cImage_Manager::Copy(const fs::path& path)
 {
-    std::unordered_map<std::string, size_t>::iterator iter =
+    std::unordered_map<std::string, cGL_Surface*>::iterator iter =
         m_index_table.find(path_to_utf8(path));
 
     if (iter == m_index_table.end()) {
@@ -102,7 +106,7 @@ cGL_Surface* cImage_Manager::Copy(const fs::path& path)
         return NULL;
     }
     else {
-        return objects[iter->second]->Copy();
+        return iter->second->Copy();
     }
 }
 
@@ -110,6 +114,9 @@ cGL_Surface* cImage_Manager::Copy(const fs::path& path)
 // before Loading_Screen_Exit().
 void cImage_Manager::Grab_Textures(bool from_file /* = 0 */, bool draw_gui /* = 0 */)
 {
+    // do not save deleted surfaces
+    Compact();
+
     // progress bar
     CEGUI::ProgressBar* progress_bar = NULL;
 
@@ -121,6 +128,11 @@ void cImage_Manager::Grab_Textures(bool from_file /* = 0 */, bool draw_gui /* =
         Loading_Screen_Draw_Text(_("Saving Textures"));
     }
 
+    // atlases can not be saved per surface
+    if (m_use_atlases) {
+        Release_Atlases();
+    }
+
     unsigned int loaded_files = 0;
     unsigned int file_count = objects.size();
 
@@ -193,6 +205,251 @@ void cImage_Manager::Restore_Textures(bool draw_gui /* = 0 */)
     }
 
     m_saved_textures.clear();
+
+    if (m_use_atlases) {
+        Build_Atlases();
+    }
+}
+
+/* atlas position of a surface
+*/
+struct Atlas_Item {
+    cGL_Surface* m_surface;
+    unsigned int m_x;
+    unsigned int m_y;
+};
+
+/* sort by texture height descending for shelf packing
+*/
+struct atlas_height_sort {
+    bool operator()(const cGL_Surface* a, const cGL_Surface* b) const
+    {
+        return a->m_tex_h > b->m_tex_h;
+    }
+};
+
+void cImage_Manager::Build_Atlases(void)
+{
+    m_use_atlases = 1;
+
+    // do not pack deleted surfaces
+    Compact();
+
+    // opengl commands are used directly
+    pVideo->Render_Finish();
+
+    GL_Surface_List surfaces;
+
+    for (GL_Surface_List::iterator itr = objects.begin(); itr != objects.end(); ++itr) {
+        cGL_Surface* obj = (*itr);
+
+        if (obj->m_atlas || !obj->m_auto_del_img || !glIsTexture(obj->m_image)) {
+            continue;
+        }
+
+        if (!obj->m_tex_w || !obj->m_tex_h || obj->m_tex_w > m_atlas_max_image_size || obj->m_tex_h > m_atlas_max_image_size) {
+            continue;
+        }
+
+        // mipmaps would mix the neighbours
+        GLint min_filter = 0;
+        glBindTexture(GL_TEXTURE_2D, obj->m_image);
+        glGetTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, &min_filter);
+
+        if (min_filter != GL_LINEAR) {
+            continue;
+        }
+
+        // texture is also used by another surface
+        if (obj->Is_Texture_Use_Multiple()) {
+            continue;
+        }
+
+        surfaces.push_back(obj);
+    }
+
+    if (surfaces.size() < 2) {
+        return;
+    }
+
+    std::stable_sort(surfaces.begin(), surfaces.end(), atlas_height_sort());
+
+    const unsigned int atlas_w = std::min(m_atlas_size, static_cast<unsigned int>(pVideo->m_max_texture_size));
+    // border around every image to keep the edge pixels on linear filtering
+    const unsigned int border = 1;
+
+    vector<GLubyte> atlas_pixels(atlas_w * atlas_w * 4);
+    vector<GLubyte> image_pixels;
+    vector<Atlas_Item> items;
+
+    unsigned int shelf_x = 0;
+    unsigned int shelf_y = 0;
+    unsigned int shelf_h = 0;
+
+    for (size_t i = 0; i <= surfaces.size(); i++) {
+        cGL_Surface* obj = i < surfaces.size() ? surfaces[i] : NULL;
+        unsigned int item_w = 0;
+        unsigned int item_h = 0;
+
+        if (obj) {
+            item_w = obj->m_tex_w + border * 2;
+            item_h = obj->m_tex_h + border * 2;
+
+            // next shelf
+            if (shelf_x + item_w > atlas_w) {
+                shelf_y += shelf_h;
+                shelf_x = 0;
+                shelf_h = 0;
+            }
+        }
+
+        // atlas is full or all surfaces are placed
+        if (!obj || shelf_y + item_h > atlas_w) {
+            // a single image is not worth an atlas
+            if (items.size() > 1) {
+                const unsigned int atlas_h = Get_Power_of_2(shelf_y + shelf_h);
+                const GLuint atlas_id = Create_Atlas_Texture(atlas_w, atlas_h, &atlas_pixels[0]);
+
+                if (atlas_id) {
+                    for (vector<Atlas_Item>::iterator itr = items.begin(); itr != items.end(); ++itr) {
+                        cGL_Surface* surface = itr->m_surface;
+
+                        glDeleteTextures(1, &surface->m_image);
+
+                        surface->m_image = atlas_id;
+                        surface->m_tex_rect = GL_rect(static_cast<float>(itr->m_x + border) / atlas_w, static_cast<float>(itr->m_y + border) / atlas_h,
+                                                      static_cast<float>(surface->m_tex_w) / atlas_w, static_cast<float>(surface->m_tex_h) / atlas_h);
+                        surface->m_atlas = 1;
+                    }
+                }
+            }
+
+            if (!obj) {
+                break;
+            }
+
+            std::fill(atlas_pixels.begin(), atlas_pixels.end(), 0);
+            items.clear();
+            shelf_x = 0;
+            shelf_y = 0;
+            shelf_h = 0;
+        }
+
+        // read the image
+        image_pixels.resize(obj->m_tex_w * obj->m_tex_h * 4);
+        glBindTexture(GL_TEXTURE_2D, obj->m_image);
+        glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, &image_pixels[0]);
+
+        // copy with the edge pixels repeated into the border
+        for (unsigned int y = 0; y < item_h; y++) {
+            const unsigned int src_y = std::min(std::max(y, border) - border, obj->m_tex_h - 1);
+            GLubyte* dest = &atlas_pixels[((shelf_y + y) * atlas_w + shelf_x) * 4];
+
+            for (unsigned int x = 0; x < item_w; x++) {
+                const unsigned int src_x = std::min(std::max(x, border) - border, obj->m_tex_w - 1);
+                memcpy(dest + x * 4, &image_pixels[(src_y * obj->m_tex_w + src_x) * 4], 4);
+            }
+        }
+
+        Atlas_Item item;
+        item.m_surface = obj;
+        item.m_x = shelf_x;
+        item.m_y = shelf_y;
+        items.push_back(item);
+
+        shelf_x += item_w;
+        shelf_h = std::max(shelf_h, item_h);
+    }
+}
+
+void cImage_Manager::Release_Atlases(void)
+{
+    // opengl commands are used directly
+    pVideo->Render_Finish();
+
+    // atlas pixels by texture id
+    typedef std::unordered_map<GLuint, vector<GLubyte> > AtlasPixelMap;
+    AtlasPixelMap atlas_pixels;
+    std::unordered_map<GLuint, GLint> atlas_widths;
+    std::unordered_map<GLuint, GLint> atlas_heights;
+    vector<GLubyte> image_pixels;
+
+    for (GL_Surface_List::iterator itr = objects.begin(); itr != objects.end(); ++itr) {
+        cGL_Surface* obj = (*itr);
+
+        if (!obj->m_atlas) {
+            continue;
+        }
+
+        const GLuint atlas_id = obj->m_image;
+        vector<GLubyte>& pixels = atlas_pixels[atlas_id];
+
+        // read the atlas once
+        if (pixels.empty()) {
+            GLint width = 0;
+            GLint height = 0;
+
+            glBindTexture(GL_TEXTURE_2D, atlas_id);
+            glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_WIDTH, &width);
+            glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_HEIGHT, &height);
+
+            pixels.resize(width * height * 4);
+            glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, &pixels[0]);
+            atlas_widths[atlas_id] = width;
+            atlas_heights[atlas_id] = height;
+        }
+
+        const GLint atlas_w = atlas_widths[atlas_id];
+        const GLint atlas_h = atlas_heights[atlas_id];
+        const unsigned int start_x = static_cast<unsigned int>(obj->m_tex_rect.m_x * atlas_w + 0.5f);
+        const unsigned int start_y = static_cast<unsigned int>(obj->m_tex_rect.m_y * atlas_h + 0.5f);
+
+        image_pixels.resize(obj->m_tex_w * obj->m_tex_h * 4);
+
+        for (unsigned int y = 0; y < obj->m_tex_h; y++) {
+            memcpy(&image_pixels[y * obj->m_tex_w * 4], &pixels[((start_y + y) * atlas_w + start_x) * 4], obj->m_tex_w * 4);
+        }
+
+        obj->m_image = Create_Atlas_Texture(obj->m_tex_w, obj->m_tex_h, &image_pixels[0]);
+        obj->m_tex_rect = GL_rect(0.0f, 0.0f, 1.0f, 1.0f);
+        obj->m_atlas = 0;
+    }
+
+    // delete the atlases
+    for (AtlasPixelMap::iterator itr = atlas_pixels.begin(); itr != atlas_pixels.end(); ++itr) {
+        GLuint atlas_id = itr->first;
+
+        if (glIsTexture(atlas_id)) {
+            glDeleteTextures(1, &atlas_id);
+        }
+    }
+}
+
+GLuint cImage_Manager::Create_Atlas_Texture(unsigned int width, unsigned int height, const GLubyte* pixels)
+{
+    GLuint tex_id = 0;
+    glGenTextures(1, &tex_id);
+
+    // if image id is 0 it failed
+    if (!tex_id) {
+        cerr << "Error : GL atlas texture generation failed" << endl;
+        return 0;
+    }
+
+    // set highest texture id
+    if (m_high_texture_id < tex_id) {
+        m_high_texture_id = tex_id;
+    }
+
+    glBindTexture(GL_TEXTURE_2D, tex_id);
+
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+    pVideo->Create_GL_Texture(width, height, pixels, 0);
+
+    return tex_id;
 }
 
 void cImage_Manager::Delete_Image_Textures(void)
@@ -209,24 +466,28 @@ void cImage_Manager::Delete_Image_Textures(void)
 
 bool cImage_Manager::Delete(size_t array_num, bool delete_data)
 {
-    if (array_num < objects.size()) {
-        std::string filepath = path_to_utf8(objects[array_num]->m_path);
-        objects.erase(objects.begin() + array_num);
-        m_index_table.erase(filepath);
+    if (array_num >= objects.size()) {
+        return 0;
     }
 
-    if (delete_data) {
-        delete objects[array_num];
-    }
-
-    return 1;
+    return Delete(objects[array_num], delete_data);
 }
 
 bool cImage_Manager::Delete(cGL_Surface* obj, bool delete_data)
 {
-    std::string filepath = path_to_utf8(obj->m_path);
+    if (!obj) {
+        return false;
+    }
+
+    std::unordered_map<std::string, cGL_Surface*>::iterator iter =
+        m_index_table.find(path_to_utf8(obj->m_path));
+
+    // the data is deleted by the next Compact
     if (cObject_Manager::Delete(obj, delete_data)) {
-        m_index_table.erase(filepath);
+        if (iter != m_index_table.end() && iter->second == obj) {
+            m_index_table.erase(iter);
+        }
+
         return true;
     }
     else {
@@ -97,6 +97,15 @@ namespace TSC {
         */
         void Restore_Textures(bool draw_gui = 0);
 
+        /* Pack the textures of small managed surfaces into shared atlas textures
+         * already packed surfaces and surfaces using mipmaps are skipped
+        */
+        void Build_Atlases(void);
+        /* Give every atlas surface its own texture again and delete the atlases
+         * the atlases are built again by Restore_Textures
+        */
+        void Release_Atlases(void);
+
         // Delete all surface textures, but keep object vector entries
         void Delete_Image_Textures(void);
 
@@ -112,11 +121,28 @@ namespace TSC {
         // highest opengl texture id found
         GLuint m_high_texture_id;
 
+        // maximum surface texture size packed into an atlas
+        static const unsigned int m_atlas_max_image_size = 128;
+        // atlas texture size
+        static const unsigned int m_atlas_size = 1024;
+
     private:
+        // Create a texture from the RGBA pixels and return its id
+        GLuint Create_Atlas_Texture(unsigned int width, unsigned int height, const GLubyte* pixels);
+
+        // if set atlases are used
+        bool m_use_atlases;
         // saved textures for reloading
         Saved_Texture_List m_saved_textures;
 
-        std::unordered_map<std::string, size_t> m_index_table;
+        // surface of every path
+        std::unordered_map<std::string, cGL_Surface*> m_index_table;
+
+    protected:
+        virtual cObject_Manager_Entry* Get_Entry(cGL_Surface* obj) const
+        {
+            return &obj->m_manager_entry;
+        }
     };
 
     /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
@@ -16,6 +16,7 @@
 
 #include "../core/global_basic.hpp"
 #include "../video/renderer.hpp"
+#include "../video/gl_state.hpp"
 #include "../core/game_core.hpp"
 #include "../core/global_basic.hpp"
 
@@ -28,7 +29,6 @@ namespace TSC {
 #endif
 
 const float doubled_pi = static_cast<float>(M_PI * 2.0f);
-static GLuint last_bind_texture = 0;
 
 /* *** *** *** *** *** *** cRender_Request *** *** *** *** *** *** *** *** *** *** *** */
 
@@ -37,6 +37,7 @@ cRender_Request::cRender_Request(void)
     m_type = REND_NOTHING;
     m_pos_z = 0.0f;
     m_render_count = 1;
+    m_pool_size = 0;
 }
 
 cRender_Request::~cRender_Request(void)
@@ -111,18 +112,11 @@ void cRender_Request_Advanced::Render_Basic(void)
     }
 
     // blend factor
-    if (m_blend_sfactor != GL_SRC_ALPHA || m_blend_dfactor != GL_ONE_MINUS_SRC_ALPHA) {
-        glBlendFunc(m_blend_sfactor, m_blend_dfactor);
-    }
+    pGL_State->Set_Blend_Func(m_blend_sfactor, m_blend_dfactor);
 }
 
 void cRender_Request_Advanced::Render_Basic_Clear(void) const
 {
-    // clear blend factor
-    if (m_blend_sfactor != GL_SRC_ALPHA || m_blend_dfactor != GL_ONE_MINUS_SRC_ALPHA) {
-        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-    }
-
     // if debug build check for errors
 #ifdef _DEBUG
     // glGetError only saves one error flag
@@ -148,24 +142,7 @@ void cRender_Request_Advanced::Render_Advanced(void)
     }
 
     // Color Combine
-    if (m_combine_type != 0) {
-        glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_COMBINE);
-        glTexEnvi(GL_TEXTURE_ENV, GL_COMBINE_RGB, m_combine_type);
-        glTexEnvi(GL_TEXTURE_ENV, GL_SOURCE0_RGB, GL_CONSTANT);
-        glTexEnvfv(GL_TEXTURE_ENV, GL_TEXTURE_ENV_COLOR, m_combine_color);
-        glTexEnvi(GL_TEXTURE_ENV, GL_SOURCE1_RGB, GL_TEXTURE);
-    }
-}
-
-void cRender_Request_Advanced::Render_Advanced_Clear(void) const
-{
-    // clear color modifications
-    if (m_combine_type != 0) {
-        float col[3] = { 0.0f, 0.0f, 0.0f };
-        glTexEnvfv(GL_TEXTURE_ENV, GL_TEXTURE_ENV_COLOR, col);
-        glTexEnvi(GL_TEXTURE_ENV, GL_COMBINE_RGB, GL_MODULATE);
-        glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
-    }
+    pGL_State->Set_Combine(m_combine_type, m_combine_color);
 }
 
 /* *** *** *** *** *** *** cLine_Request *** *** *** *** *** *** *** *** *** *** *** */
@@ -201,21 +178,17 @@ void cLine_Request::Draw(void)
     Render_Advanced();
 
     // color
-    if (m_color.red != 255 || m_color.green != 255 || m_color.blue != 255 || m_color.alpha != 255) {
-        glColor4ub(m_color.red, m_color.green, m_color.blue, m_color.alpha);
-    }
+    pGL_State->Set_Color(m_color);
 
-    if (glIsEnabled(GL_TEXTURE_2D)) {
-        glDisable(GL_TEXTURE_2D);
-    }
+    // untextured
+    pGL_State->Set_Enabled(GL_TEXTURE_2D, 0);
+
+    // width
+    pGL_State->Set_Line_Width(m_line_width);
+    // stipple pattern
+    pGL_State->Set_Enabled(GL_LINE_STIPPLE, m_stipple_pattern != 0);
 
-    // change width
-    if (m_line_width != 1.0f) {
-        glLineWidth(m_line_width);
-    }
-    // enable stipple pattern
     if (m_stipple_pattern != 0) {
-        glEnable(GL_LINE_STIPPLE);
         glLineStipple(2, m_stipple_pattern);
     }
 
@@ -224,21 +197,6 @@ void cLine_Request::Draw(void)
     glVertex2f(m_line.m_x2, m_line.m_y2);
     glEnd();
 
-    // clear stipple pattern
-    if (m_stipple_pattern != 0) {
-        glDisable(GL_LINE_STIPPLE);
-    }
-    // clear line width
-    if (m_line_width != 1.0f) {
-        glLineWidth(1.0f);
-    }
-
-    // clear color
-    if (m_color.red != 255 || m_color.green != 255 || m_color.blue != 255 || m_color.alpha != 255) {
-        glColor4f(1.0f, 1.0f, 1.0f, 1.0f);
-    }
-
-    Render_Advanced_Clear();
     Render_Basic_Clear();
 }
 
@@ -292,25 +250,21 @@ void cRect_Request::Draw(void)
     Render_Advanced();
 
     // color
-    if (m_color.red != 255 || m_color.green != 255 || m_color.blue != 255 || m_color.alpha != 255) {
-        glColor4ub(m_color.red, m_color.green, m_color.blue, m_color.alpha);
-    }
+    pGL_State->Set_Color(m_color);
 
-    if (glIsEnabled(GL_TEXTURE_2D)) {
-        glDisable(GL_TEXTURE_2D);
-    }
+    // untextured
+    pGL_State->Set_Enabled(GL_TEXTURE_2D, 0);
 
     if (m_filled) {
         glBegin(GL_POLYGON);
     }
     else {
-        // change width
-        if (m_line_width != 1.0f) {
-            glLineWidth(m_line_width);
-        }
-        // enable stipple pattern
+        // width
+        pGL_State->Set_Line_Width(m_line_width);
+        // stipple pattern
+        pGL_State->Set_Enabled(GL_LINE_STIPPLE, m_stipple_pattern != 0);
+
         if (m_stipple_pattern != 0) {
-            glEnable(GL_LINE_STIPPLE);
             glLineStipple(2, m_stipple_pattern);
         }
 
@@ -326,21 +280,6 @@ void cRect_Request::Draw(void)
     glVertex2f(-half_w, half_h);
     glEnd();
 
-    // clear stipple pattern
-    if (m_stipple_pattern != 0) {
-        glDisable(GL_LINE_STIPPLE);
-    }
-    // clear line width
-    if (m_line_width != 1.0f) {
-        glLineWidth(1.0f);
-    }
-
-    // clear color
-    if (m_color.red != 255 || m_color.green != 255 || m_color.blue != 255 || m_color.alpha != 255) {
-        glColor4f(1.0f, 1.0f, 1.0f, 1.0f);
-    }
-
-    Render_Advanced_Clear();
     Render_Basic_Clear();
 }
 
@@ -374,18 +313,17 @@ void cGradient_Request::Draw(void)
         glTranslatef(m_rect.m_x, m_rect.m_y, m_pos_z);
     }
 
-    if (glIsEnabled(GL_TEXTURE_2D)) {
-        glDisable(GL_TEXTURE_2D);
-    }
+    // untextured
+    pGL_State->Set_Enabled(GL_TEXTURE_2D, 0);
 
     Render_Advanced();
 
     if (m_dir == DIR_VERTICAL) {
         glBegin(GL_POLYGON);
-        glColor4ub(m_color_1.red, m_color_1.green, m_color_1.blue, m_color_1.alpha);
+        pGL_State->Set_Color(m_color_1);
         glVertex2f(0.0f, 0.0f);
         glVertex2f(m_rect.m_w, 0.0f);
-        glColor4ub(m_color_2.red, m_color_2.green, m_color_2.blue, m_color_2.alpha);
+        pGL_State->Set_Color(m_color_2);
         glVertex2f(m_rect.m_w, m_rect.m_h);
         glVertex2f(0.0f, m_rect.m_h);
         glEnd();
@@ -393,19 +331,15 @@ void cGradient_Request::Draw(void)
     }
     else if (m_dir == DIR_HORIZONTAL) {
         glBegin(GL_POLYGON);
-        glColor4ub(m_color_1.red, m_color_1.green, m_color_1.blue, m_color_1.alpha);
+        pGL_State->Set_Color(m_color_1);
         glVertex2f(0.0f, m_rect.m_h);
         glVertex2f(0.0f, 0.0f);
-        glColor4ub(m_color_2.red, m_color_2.green, m_color_2.blue, m_color_2.alpha);
+        pGL_State->Set_Color(m_color_2);
         glVertex2f(m_rect.m_w, 0.0f);
         glVertex2f(m_rect.m_w, m_rect.m_h);
         glEnd();
     }
 
-    // clear color
-    glColor4f(1.0f, 1.0f, 1.0f, 1.0f);
-
-    Render_Advanced_Clear();
     Render_Basic_Clear();
 }
 
@@ -443,18 +377,15 @@ void cCircle_Request::Draw(void)
     Render_Advanced();
 
     // color
-    if (m_color.red != 255 || m_color.green != 255 || m_color.blue != 255 || m_color.alpha != 255) {
-        glColor4ub(m_color.red, m_color.green, m_color.blue, m_color.alpha);
-    }
+    pGL_State->Set_Color(m_color);
 
-    if (glIsEnabled(GL_TEXTURE_2D)) {
-        glDisable(GL_TEXTURE_2D);
-    }
+    // untextured
+    pGL_State->Set_Enabled(GL_TEXTURE_2D, 0);
 
     // not filled
     if (m_line_width) {
         // set line width
-        glLineWidth(m_line_width);
+        pGL_State->Set_Line_Width(m_line_width);
 
         glBegin(GL_LINE_STRIP);
     }
@@ -487,17 +418,6 @@ void cCircle_Request::Draw(void)
 
     glEnd();
 
-    // clear line width
-    if (m_line_width != 1) {
-        glLineWidth(1.0f);
-    }
-
-    // clear color
-    if (m_color.red != 255 || m_color.green != 255 || m_color.blue != 255 || m_color.alpha != 255) {
-        glColor4f(1.0f, 1.0f, 1.0f, 1.0f);
-    }
-
-    Render_Advanced_Clear();
     Render_Basic_Clear();
 }
 
@@ -508,6 +428,7 @@ cSurface_Request::cSurface_Request(void)
 {
     m_type = REND_SURFACE;
     m_texture_id = 0;
+    m_tex_rect = GL_rect(0.0f, 0.0f, 1.0f, 1.0f);
 
     m_pos_x = 0.0f;
     m_pos_y = 0.0f;
@@ -600,48 +521,273 @@ void cSurface_Request::Draw(void)
     Render_Advanced();
 
     // color
-    if (m_color.red != 255 || m_color.green != 255 || m_color.blue != 255 || m_color.alpha != 255) {
-        glColor4ub(m_color.red, m_color.green, m_color.blue, m_color.alpha);
-    }
-
-    if (!glIsEnabled(GL_TEXTURE_2D)) {
-        glEnable(GL_TEXTURE_2D);
-    }
+    pGL_State->Set_Color(m_color);
 
+    pGL_State->Set_Enabled(GL_TEXTURE_2D, 1);
     // only bind if not the same texture
-    if (last_bind_texture != m_texture_id) {
-        glBindTexture(GL_TEXTURE_2D, m_texture_id);
-        last_bind_texture = m_texture_id;
-    }
+    pGL_State->Bind_Texture(m_texture_id);
 
     /* vertex arrays should not be used to draw simple primitives as it
      * does have no positive performance gain
     */
+    const float tex_x2 = m_tex_rect.m_x + m_tex_rect.m_w;
+    const float tex_y2 = m_tex_rect.m_y + m_tex_rect.m_h;
+
     // rectangle
     glBegin(GL_QUADS);
     // top left
-    glTexCoord2f(0.0f, 0.0f);
+    glTexCoord2f(m_tex_rect.m_x, m_tex_rect.m_y);
     glVertex2f(-half_w, -half_h);
     // top right
-    glTexCoord2f(1.0f, 0.0f);
+    glTexCoord2f(tex_x2, m_tex_rect.m_y);
     glVertex2f(half_w, -half_h);
     // bottom right
-    glTexCoord2f(1.0f, 1.0f);
+    glTexCoord2f(tex_x2, tex_y2);
     glVertex2f(half_w, half_h);
     // bottom left
-    glTexCoord2f(0.0f, 1.0f);
+    glTexCoord2f(m_tex_rect.m_x, tex_y2);
     glVertex2f(-half_w, half_h);
     glEnd();
 
-    // clear color
-    if (m_color.red != 255 || m_color.green != 255 || m_color.blue != 255 || m_color.alpha != 255) {
-        /* alpha is automatically 1 for glColor3f
-         * update : not on the shitty intel drivers :(
-        */
-        glColor4f(1.0f, 1.0f, 1.0f, 1.0f);
+    Render_Basic_Clear();
+}
+
+/* *** *** *** *** *** *** cSurface_Batch *** *** *** *** *** *** *** *** *** *** *** */
+
+cSurface_Batch::cSurface_Batch(void)
+{
+    m_texture_id = 0;
+    m_global_scale = 1;
+    m_blend_sfactor = GL_SRC_ALPHA;
+    m_blend_dfactor = GL_ONE_MINUS_SRC_ALPHA;
+    m_combine_type = 0;
+    m_combine_color[0] = 0.0f;
+    m_combine_color[1] = 0.0f;
+    m_combine_color[2] = 0.0f;
+
+    m_vertices.reserve(4 * 256);
+}
+
+cSurface_Batch::~cSurface_Batch(void)
+{
+
+}
+
+bool cSurface_Batch::Is_Batchable(const cSurface_Request* request)
+{
+    // the shadow is drawn as an additional request with a different state
+    if (request->m_shadow_pos) {
+        return 0;
+    }
+
+    return 1;
+}
+
+bool cSurface_Batch::Is_Compatible(const cSurface_Request* request) const
+{
+    if (Is_Empty()) {
+        return 1;
+    }
+
+    if (request->m_texture_id != m_texture_id || request->m_global_scale != m_global_scale) {
+        return 0;
+    }
+
+    if (request->m_blend_sfactor != m_blend_sfactor || request->m_blend_dfactor != m_blend_dfactor) {
+        return 0;
+    }
+
+    if (request->m_combine_type != m_combine_type) {
+        return 0;
+    }
+
+    // combine color is only used with a combine type
+    if (m_combine_type != 0 && (request->m_combine_color[0] != m_combine_color[0] || request->m_combine_color[1] != m_combine_color[1] || request->m_combine_color[2] != m_combine_color[2])) {
+        return 0;
+    }
+
+    return 1;
+}
+
+void cSurface_Batch::Add(const cSurface_Request* request)
+{
+    // take over the render state
+    if (Is_Empty()) {
+        m_texture_id = request->m_texture_id;
+        m_global_scale = request->m_global_scale;
+        m_blend_sfactor = request->m_blend_sfactor;
+        m_blend_dfactor = request->m_blend_dfactor;
+        m_combine_type = request->m_combine_type;
+        m_combine_color[0] = request->m_combine_color[0];
+        m_combine_color[1] = request->m_combine_color[1];
+        m_combine_color[2] = request->m_combine_color[2];
+    }
+
+    // get half the size
+    const float half_w = request->m_w / 2;
+    const float half_h = request->m_h / 2;
+    // position
+    float final_pos_x = request->m_pos_x + (half_w * request->m_scale_x);
+    float final_pos_y = request->m_pos_y + (half_h * request->m_scale_y);
+
+    // set camera position
+    if (!request->m_no_camera) {
+        final_pos_x -= pActive_Camera->m_x;
+        final_pos_y -= pActive_Camera->m_y;
+    }
+
+    Add_Quad(m_vertices, final_pos_x, final_pos_y, request->m_pos_z, half_w, half_h, request->m_scale_x, request->m_scale_y, request->m_scale_z, request->m_rot_x, request->m_rot_y, request->m_rot_z, request->m_tex_rect, request->m_color);
+}
+
+void cSurface_Batch::Add_Quad(VertexList& vertices, float pos_x, float pos_y, float pos_z, float half_w, float half_h, float scale_x, float scale_y, float scale_z, float rot_x, float rot_y, float rot_z, const GL_rect& tex_rect, const Color& color)
+{
+    // rotation as done by glRotatef in cRender_Request_Advanced::Render_Advanced
+    const float deg_to_rad = static_cast<float>(M_PI / 180.0);
+    const float cos_x = cos(rot_x * deg_to_rad);
+    const float sin_x = sin(rot_x * deg_to_rad);
+    const float cos_y = cos(rot_y * deg_to_rad);
+    const float sin_y = sin(rot_y * deg_to_rad);
+    const float cos_z = cos(rot_z * deg_to_rad);
+    const float sin_z = sin(rot_z * deg_to_rad);
+
+    // top left, top right, bottom right, bottom left
+    static const float corners[4][2] = { { -1.0f, -1.0f }, { 1.0f, -1.0f }, { 1.0f, 1.0f }, { -1.0f, 1.0f } };
+    static const float tex_coords[4][2] = { { 0.0f, 0.0f }, { 1.0f, 0.0f }, { 1.0f, 1.0f }, { 0.0f, 1.0f } };
+
+    for (unsigned int i = 0; i < 4; i++) {
+        float x = corners[i][0] * half_w;
+        float y = corners[i][1] * half_h;
+        float z = 0.0f;
+        float temp;
+
+        // z rotation
+        temp = x * cos_z - y * sin_z;
+        y = x * sin_z + y * cos_z;
+        x = temp;
+        // y rotation
+        temp = x * cos_y + z * sin_y;
+        z = -x * sin_y + z * cos_y;
+        x = temp;
+        // x rotation
+        temp = y * cos_x - z * sin_x;
+        z = y * sin_x + z * cos_x;
+        y = temp;
+
+        Vertex vertex;
+        // scale and translate
+        vertex.m_x = pos_x + x * scale_x;
+        vertex.m_y = pos_y + y * scale_y;
+        vertex.m_z = pos_z + z * scale_z;
+        vertex.m_u = tex_rect.m_x + tex_coords[i][0] * tex_rect.m_w;
+        vertex.m_v = tex_rect.m_y + tex_coords[i][1] * tex_rect.m_h;
+        vertex.m_color[0] = color.red;
+        vertex.m_color[1] = color.green;
+        vertex.m_color[2] = color.blue;
+        vertex.m_color[3] = color.alpha;
+
+        vertices.push_back(vertex);
+    }
+}
+
+void cSurface_Batch::Flush(void)
+{
+    if (Is_Empty()) {
+        return;
+    }
+
+    // clear the matrix as the vertices are already transformed
+    glLoadIdentity();
+
+    // global scale
+    if (m_global_scale && (global_upscalex != 1.0f || global_upscaley != 1.0f)) {
+        glScalef(global_upscalex, global_upscaley, 1.0f);
+    }
+
+    // blend factor
+    pGL_State->Set_Blend_Func(m_blend_sfactor, m_blend_dfactor);
+    // Color Combine
+    pGL_State->Set_Combine(m_combine_type, m_combine_color);
+
+    pGL_State->Set_Enabled(GL_TEXTURE_2D, 1);
+    // only bind if not the same texture
+    pGL_State->Bind_Texture(m_texture_id);
+
+    Draw_Quads(m_vertices);
+
+    m_vertices.clear();
+}
+
+void cSurface_Batch::Draw_Quads(const VertexList& vertices)
+{
+    if (vertices.empty()) {
+        return;
     }
 
-    Render_Advanced_Clear();
+    const GLsizei stride = sizeof(Vertex);
+
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+    glEnableClientState(GL_COLOR_ARRAY);
+
+    glVertexPointer(3, GL_FLOAT, stride, &vertices[0].m_x);
+    glTexCoordPointer(2, GL_FLOAT, stride, &vertices[0].m_u);
+    glColorPointer(4, GL_UNSIGNED_BYTE, stride, vertices[0].m_color);
+
+    glDrawArrays(GL_QUADS, 0, static_cast<GLsizei>(vertices.size()));
+
+    glDisableClientState(GL_COLOR_ARRAY);
+    glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+    glDisableClientState(GL_VERTEX_ARRAY);
+
+    // the current color is undefined after using a color array
+    pGL_State->Invalidate_Color();
+}
+
+/* *** *** *** *** *** *** cSurface_Array_Request *** *** *** *** *** *** *** *** *** *** *** */
+
+cSurface_Array_Request::cSurface_Array_Request(void)
+    : cRender_Request_Advanced()
+{
+    m_type = REND_SURFACE_ARRAY;
+    m_texture_id = 0;
+    m_no_camera = 0;
+}
+
+cSurface_Array_Request::~cSurface_Array_Request(void)
+{
+
+}
+
+void cSurface_Array_Request::Add(float pos_x, float pos_y, float pos_z, float w, float h, float scale, float rot_x, float rot_y, float rot_z, const GL_rect& tex_rect, const Color& color)
+{
+    // get half the size
+    const float half_w = w / 2;
+    const float half_h = h / 2;
+
+    cSurface_Batch::Add_Quad(m_vertices, pos_x + (half_w * scale), pos_y + (half_h * scale), pos_z, half_w, half_h, scale, scale, 1.0f, rot_x, rot_y, rot_z, tex_rect, color);
+}
+
+void cSurface_Array_Request::Draw(void)
+{
+    if (m_vertices.empty()) {
+        return;
+    }
+
+    Render_Basic();
+
+    // set camera position
+    if (!m_no_camera) {
+        glTranslatef(-pActive_Camera->m_x, -pActive_Camera->m_y, 0.0f);
+    }
+
+    Render_Advanced();
+
+    pGL_State->Set_Enabled(GL_TEXTURE_2D, 1);
+    // only bind if not the same texture
+    pGL_State->Bind_Texture(m_texture_id);
+
+    cSurface_Batch::Draw_Quads(m_vertices);
+
     Render_Basic_Clear();
 }
 
@@ -655,6 +801,12 @@ cRenderQueue::cRenderQueue(unsigned int reserve_items)
 cRenderQueue::~cRenderQueue(void)
 {
     Clear();
+
+    for (MemoryPool::iterator itr = m_memory_pool.begin(); itr != m_memory_pool.end(); ++itr) {
+        for (vector<void*>::iterator mem_itr = itr->second.begin(); mem_itr != itr->second.end(); ++mem_itr) {
+            ::operator delete(*mem_itr);
+        }
+    }
 }
 
 void cRenderQueue::Add(cRender_Request* obj)
@@ -665,7 +817,7 @@ void cRenderQueue::Add(cRender_Request* obj)
 
     // if no type
     if (obj->m_type == REND_NOTHING) {
-        delete obj;
+        Release(obj);
         return;
     }
     else {
@@ -679,23 +831,144 @@ void cRenderQueue::Add(cRender_Request* obj)
  */
 void cRenderQueue::Render(bool clear /* = 1 */)
 {
-    // z position sort
-    std::sort(m_render_data.begin(), m_render_data.end(), zpos_sort());
-    // reset last texture
-    last_bind_texture = 0;
+    Sort();
+    // other code may have changed the state
+    pGL_State->Start_Frame();
 
     for (RenderList::iterator itr = m_render_data.begin(); itr != m_render_data.end(); ++itr) {
         cRender_Request* obj = (*itr);
 
+        // collect consecutive surfaces with the same state
+        if (obj->m_type == REND_SURFACE) {
+            cSurface_Request* surface = static_cast<cSurface_Request*>(obj);
+
+            if (cSurface_Batch::Is_Batchable(surface)) {
+                if (!m_surface_batch.Is_Compatible(surface)) {
+                    m_surface_batch.Flush();
+                }
+
+                m_surface_batch.Add(surface);
+                obj->m_render_count--;
+                continue;
+            }
+        }
+
+        // keep the order
+        m_surface_batch.Flush();
+
         obj->Draw();
         obj->m_render_count--;
     }
 
+    m_surface_batch.Flush();
+
+    // state expected by the gui renderer
+    pGL_State->Restore_Defaults();
+
     if (clear) {
         Clear(0);
     }
 }
 
+/* Return the blend factor as 4 bit value
+*/
+static uint64_t Get_Blend_Factor_Key(GLenum factor)
+{
+    if (factor == GL_ZERO || factor == GL_ONE) {
+        return factor;
+    }
+    // GL_SRC_COLOR to GL_SRC_ALPHA_SATURATE
+    if (factor >= GL_SRC_COLOR && factor <= GL_SRC_ALPHA_SATURATE) {
+        return 2 + (factor - GL_SRC_COLOR);
+    }
+
+    return 15;
+}
+
+uint64_t cRenderQueue::Get_Sort_Key(const cRender_Request* obj)
+{
+    /* z position bits mapped to keep the float order as unsigned integer
+     * negative values get all bits flipped and positive values the sign bit set
+    */
+    uint32_t z_bits;
+    memcpy(&z_bits, &obj->m_pos_z, sizeof(z_bits));
+    z_bits = (z_bits & 0x80000000u) ? ~z_bits : (z_bits | 0x80000000u);
+
+    uint64_t texture = 0;
+    uint64_t blend = 0;
+
+    if (obj->m_type != REND_CLEAR && obj->m_type != REND_NOTHING) {
+        const cRender_Request_Advanced* advanced = static_cast<const cRender_Request_Advanced*>(obj);
+
+        blend = (Get_Blend_Factor_Key(advanced->m_blend_sfactor) << 5) | (Get_Blend_Factor_Key(advanced->m_blend_dfactor) << 1) | (advanced->m_combine_type != 0);
+
+        if (obj->m_type == REND_SURFACE) {
+            texture = static_cast<const cSurface_Request*>(obj)->m_texture_id & 0x7FFFF;
+        }
+        else if (obj->m_type == REND_SURFACE_ARRAY) {
+            texture = static_cast<const cSurface_Array_Request*>(obj)->m_texture_id & 0x7FFFF;
+        }
+    }
+
+    // 32 bit z, 4 bit type, 19 bit texture and 9 bit blend
+    return (static_cast<uint64_t>(z_bits) << 32) | ((static_cast<uint64_t>(obj->m_type) & 0xF) << 28) | (texture << 9) | blend;
+}
+
+void cRenderQueue::Sort(void)
+{
+    const size_t count = m_render_data.size();
+
+    if (count < 2) {
+        return;
+    }
+
+    m_sort_items.resize(count);
+    m_sort_temp.resize(count);
+
+    uint64_t all_and = ~static_cast<uint64_t>(0);
+    uint64_t all_or = 0;
+
+    for (size_t i = 0; i < count; i++) {
+        m_sort_items[i].m_key = Get_Sort_Key(m_render_data[i]);
+        m_sort_items[i].m_request = m_render_data[i];
+
+        all_and &= m_sort_items[i].m_key;
+        all_or |= m_sort_items[i].m_key;
+    }
+
+    // least significant digit first keeps the order of equal keys
+    for (unsigned int shift = 0; shift < 64; shift += 8) {
+        // skip if the byte is the same for all keys
+        if (((all_and ^ all_or) >> shift & 0xFF) == 0) {
+            continue;
+        }
+
+        size_t offsets[256] = { 0 };
+
+        for (size_t i = 0; i < count; i++) {
+            offsets[(m_sort_items[i].m_key >> shift) & 0xFF]++;
+        }
+
+        size_t total = 0;
+
+        for (unsigned int i = 0; i < 256; i++) {
+            const size_t bucket_count = offsets[i];
+            offsets[i] = total;
+            total += bucket_count;
+        }
+
+        for (size_t i = 0; i < count; i++) {
+            m_sort_temp[offsets[(m_sort_items[i].m_key >> shift) & 0xFF]++] = m_sort_items[i];
+        }
+
+        m_sort_items.swap(m_sort_temp);
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        m_render_data[i] = m_sort_items[i].m_request;
+    }
+}
+
 void cRenderQueue::Fake_Render(unsigned int amount /* = 1 */, bool clear /* = 1 */)
 {
     for (RenderList::iterator itr = m_render_data.begin(); itr != m_render_data.end(); ++itr) {
@@ -708,21 +981,53 @@ void cRenderQueue::Fake_Render(unsigned int amount /* = 1 */, bool clear /* = 1
     }
 }
 
+void cRenderQueue::Release(cRender_Request* obj)
+{
+    if (!obj->m_pool_size) {
+        delete obj;
+        return;
+    }
+
+    const size_t size = obj->m_pool_size;
+    // start of the most derived object
+    void* mem = dynamic_cast<void*>(obj);
+
+    obj->~cRender_Request();
+    m_memory_pool[size].push_back(mem);
+}
+
+void* cRenderQueue::Alloc_Memory(size_t size)
+{
+    vector<void*>& pool = m_memory_pool[size];
+
+    if (pool.empty()) {
+        return ::operator new(size);
+    }
+
+    void* mem = pool.back();
+    pool.pop_back();
+    return mem;
+}
+
 void cRenderQueue::Clear(bool force /* = 1 */)
 {
-    for (RenderList::iterator itr = m_render_data.begin(); itr != m_render_data.end();) {
+    // move the requests to keep to the front in their order
+    RenderList::iterator keep_itr = m_render_data.begin();
+
+    for (RenderList::iterator itr = m_render_data.begin(); itr != m_render_data.end(); ++itr) {
         cRender_Request* obj = (*itr);
 
         // if forced or finished rendering
         if (force || obj->m_render_count <= 0) {
-            itr = m_render_data.erase(itr);
-            delete obj;
+            Release(obj);
         }
-        // increment
         else {
-            ++itr;
+            *keep_itr = obj;
+            ++keep_itr;
         }
     }
+
+    m_render_data.erase(keep_itr, m_render_data.end());
 }
 
 /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
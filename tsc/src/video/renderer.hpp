@@ -33,7 +33,8 @@ namespace TSC {
         REND_SURFACE = 4,
         REND_TEXT = 5,
         REND_LINE = 6,
-        REND_CIRCLE = 7
+        REND_CIRCLE = 7,
+        REND_SURFACE_ARRAY = 8
     };
 
     /* *** *** *** *** *** *** cRender_Request *** *** *** *** *** *** *** *** *** *** *** */
@@ -52,6 +53,8 @@ namespace TSC {
         float m_pos_z;
         // times to render until deletion
         int m_render_count;
+        // size of the memory if allocated by cRenderQueue::Alloc or 0
+        size_t m_pool_size;
     };
 
     typedef vector<cRender_Request*> RenderList;
@@ -81,8 +84,6 @@ namespace TSC {
 
         // render advanced state
         void Render_Advanced(void);
-        // clear advanced render state
-        void Render_Advanced_Clear(void) const;
 
         // global scale
         bool m_global_scale;
@@ -202,6 +203,8 @@ namespace TSC {
 
         // texture id
         GLuint m_texture_id;
+        // texture coordinates
+        GL_rect m_tex_rect;
         // position
         float m_pos_x;
         float m_pos_y;
@@ -220,6 +223,94 @@ namespace TSC {
         bool m_delete_texture;
     };
 
+    /* *** *** *** *** *** *** cSurface_Batch *** *** *** *** *** *** *** *** *** *** *** */
+
+    /* Collects consecutive surface requests with the same render state
+     * and draws them with a single vertex array call
+     * position, scale and rotation are applied on the CPU
+    */
+    class cSurface_Batch {
+    public:
+        cSurface_Batch(void);
+        ~cSurface_Batch(void);
+
+        // Return true if the request can be drawn in a batch
+        static bool Is_Batchable(const cSurface_Request* request);
+        // Return true if the request uses the render state of the current batch
+        bool Is_Compatible(const cSurface_Request* request) const;
+
+        /* Add the request quad
+         * the batch must be empty or compatible with the request
+        */
+        void Add(const cSurface_Request* request);
+        // Draw all added quads and clear the batch
+        void Flush(void);
+
+        // Return true if nothing was added
+        inline bool Is_Empty(void) const
+        {
+            return m_vertices.empty();
+        }
+
+        struct Vertex {
+            GLfloat m_x;
+            GLfloat m_y;
+            GLfloat m_z;
+            GLfloat m_u;
+            GLfloat m_v;
+            GLubyte m_color[4];
+        };
+        typedef vector<Vertex> VertexList;
+
+        /* Add the quad vertices of a surface to the list
+         * pos_x and pos_y are the center of the quad
+         * rotation and scale are applied around the center
+        */
+        static void Add_Quad(VertexList& vertices, float pos_x, float pos_y, float pos_z, float half_w, float half_h, float scale_x, float scale_y, float scale_z, float rot_x, float rot_y, float rot_z, const GL_rect& tex_rect, const Color& color);
+
+        // Draw the quads with client vertex arrays
+        static void Draw_Quads(const VertexList& vertices);
+
+    private:
+
+        // render state of the batch
+        GLuint m_texture_id;
+        bool m_global_scale;
+        GLenum m_blend_sfactor;
+        GLenum m_blend_dfactor;
+        GLint m_combine_type;
+        float m_combine_color[3];
+
+        // quad vertices
+        VertexList m_vertices;
+    };
+
+    /* *** *** *** *** *** *** cSurface_Array_Request *** *** *** *** *** *** *** *** *** *** *** */
+
+    /* Many quads of the same texture drawn with one vertex array
+     * the quads share the blend and combine state of the request
+     * and the camera position is subtracted if m_no_camera is not set
+    */
+    class cSurface_Array_Request : public cRender_Request_Advanced {
+    public:
+        cSurface_Array_Request(void);
+        virtual ~cSurface_Array_Request(void);
+
+        // Draw
+        virtual void Draw(void);
+
+        /* Add a quad
+         * the position is the top left corner of the unscaled quad
+         * scale and rotation are applied around the center
+        */
+        void Add(float pos_x, float pos_y, float pos_z, float w, float h, float scale, float rot_x, float rot_y, float rot_z, const GL_rect& tex_rect, const Color& color);
+
+        // texture id
+        GLuint m_texture_id;
+        // quad vertices in level coordinates
+        cSurface_Batch::VertexList m_vertices;
+    };
+
     /* *** *** *** *** *** *** cRenderQueue *** *** *** *** *** *** *** *** *** *** *** */
 
     class cRenderQueue {
@@ -231,6 +322,20 @@ namespace TSC {
         */
         void Add(cRender_Request* obj);
 
+        /* Return a new request of the given type
+         * reuses the memory of finished requests
+        */
+        template<class T> T* Alloc(void)
+        {
+            T* request = new (Alloc_Memory(sizeof(T))) T();
+            request->m_pool_size = sizeof(T);
+            return request;
+        }
+        /* Destroy the request
+         * the memory is kept for reuse if allocated by Alloc
+        */
+        void Release(cRender_Request* obj);
+
         /* Render current data
          * clear: if set clear the finished data after rendering
         */
@@ -247,16 +352,35 @@ namespace TSC {
         */
         void Clear(bool force = 1);
 
+        /* Return the sort key of the request
+         * ordered by z position, render type, texture and blend mode
+        */
+        static uint64_t Get_Sort_Key(const cRender_Request* obj);
+
         // render data array
         RenderList m_render_data;
+        // surface batch used while rendering
+        cSurface_Batch m_surface_batch;
+
+    private:
+        // Sort the render data by the sort key keeping the order of equal keys
+        void Sort(void);
+
+        // Return memory of the given size from the pool
+        void* Alloc_Memory(size_t size);
+
+        typedef std::unordered_map<size_t, vector<void*> > MemoryPool;
+        // unused request memory by size
+        MemoryPool m_memory_pool;
 
-        // Z position sort
-        struct zpos_sort {
-            bool operator()(const cRender_Request* a, const cRender_Request* b) const
-            {
-                return a->m_pos_z < b->m_pos_z;
-            }
+        struct Sort_Item {
+            uint64_t m_key;
+            cRender_Request* m_request;
         };
+        typedef vector<Sort_Item> SortList;
+        // radix sort buffers
+        SortList m_sort_items;
+        SortList m_sort_temp;
     };
 
     /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
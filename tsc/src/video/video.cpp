@@ -1136,7 +1136,7 @@ Color cVideo::Get_Pixel(int x, int y) const
 
 void cVideo::Clear_Screen(void) const
 {
-    pRenderer->Add(new cClear_Request());
+    pRenderer->Add(pRenderer->Alloc<cClear_Request>());
 }
 
 void cVideo::Draw_Rect(const GL_rect* rect, float z, const Color* color, cRect_Request* request /* = NULL */) const
@@ -1160,7 +1160,7 @@ void cVideo::Draw_Rect(float x, float y, float width, float height, float z, con
     if (!request) {
         create_request = 1;
         // create request
-        request = new cRect_Request();
+        request = pRenderer->Alloc<cRect_Request>();
     }
 
     // rect
@@ -1202,7 +1202,7 @@ void cVideo::Draw_Gradient(float x, float y, float width, float height, float z,
     if (!request) {
         create_request = 1;
         // create request
-        request = new cGradient_Request();
+        request = pRenderer->Alloc<cGradient_Request>();
     }
 
     // rect
@@ -1238,7 +1238,7 @@ void cVideo::Draw_Circle(float x, float y, float radius, float z, const Color* c
     if (!request) {
         create_request = 1;
         // create request
-        request = new cCircle_Request();
+        request = pRenderer->Alloc<cCircle_Request>();
     }
 
     // position
@@ -1279,7 +1279,7 @@ void cVideo::Draw_Line(float x1, float y1, float x2, float y2, float z, const Co
     if (!request) {
         create_request = 1;
         // create request
-        request = new cLine_Request();
+        request = pRenderer->Alloc<cLine_Request>();
     }
 
     // line
@@ -1567,7 +1567,7 @@ void Draw_Effect_Out(Effect_Fadeout effect /* = EFFECT_OUT_RANDOM */, float spee
             color.alpha = static_cast<uint8_t>(45 - (45 * i));
 
             // create request
-            cRect_Request* request = new cRect_Request();
+            cRect_Request* request = pRenderer->Alloc<cRect_Request>();
             pVideo->Draw_Rect(NULL, 0.9f, &color, request);
 
             request->m_render_count = 2;
@@ -1614,7 +1614,7 @@ void Draw_Effect_Out(Effect_Fadeout effect /* = EFFECT_OUT_RANDOM */, float spee
             }
 
             // draw gradient
-            cGradient_Request* gradient_request = new cGradient_Request();
+            cGradient_Request* gradient_request = pRenderer->Alloc<cGradient_Request>();
 
             // horizontal
             if (hor) {
@@ -1635,7 +1635,7 @@ void Draw_Effect_Out(Effect_Fadeout effect /* = EFFECT_OUT_RANDOM */, float spee
             // add request
             pRenderer->Add(gradient_request);
 
-            gradient_request = new cGradient_Request();
+            gradient_request = pRenderer->Alloc<cGradient_Request>();
 
             // horizontal
             if (hor) {
@@ -1695,7 +1695,7 @@ void Draw_Effect_Out(Effect_Fadeout effect /* = EFFECT_OUT_RANDOM */, float spee
 
             // ## item
             // create request
-            cSurface_Request* request = new cSurface_Request();
+            cSurface_Request* request = pRenderer->Alloc<cSurface_Request>();
             image->Blit((game_res_w * 0.5f) - ((image->m_w * f) / 2) , game_res_h * 0.5f - ((image->m_h * f) / 2), 0.9f, request);
 
             request->m_blend_sfactor = GL_SRC_ALPHA;
@@ -1715,7 +1715,7 @@ void Draw_Effect_Out(Effect_Fadeout effect /* = EFFECT_OUT_RANDOM */, float spee
             color = Color(0, 0, 0, static_cast<uint8_t>(50 + (f * 4)));
 
             // create request
-            cRect_Request* rect_request = new cRect_Request();
+            cRect_Request* rect_request = pRenderer->Alloc<cRect_Request>();
             pVideo->Draw_Rect(NULL, 0.901f, &color, rect_request);
 
             // add request
@@ -1757,7 +1757,7 @@ void Draw_Effect_Out(Effect_Fadeout effect /* = EFFECT_OUT_RANDOM */, float spee
 
             for (unsigned int g = 0; g < 50; g++) {
                 // create request
-                cRect_Request* request = new cRect_Request();
+                cRect_Request* request = pRenderer->Alloc<cRect_Request>();
                 pVideo->Draw_Rect(Get_Random_Float(-rect_size * 0.5f, game_res_w - rect_size * 0.5f), Get_Random_Float(-rect_size * 0.5f, game_res_h - rect_size * 0.5f), rect_size, rect_size, 0.9f, &rand_color, request);
 
                 request->m_render_count = 2;
@@ -1839,7 +1839,7 @@ void Draw_Effect_Out(Effect_Fadeout effect /* = EFFECT_OUT_RANDOM */, float spee
                     color.alpha = static_cast<uint8_t>(grid[y][x] * 0.4f);
 
                     // create request
-                    cRect_Request* request = new cRect_Request();
+                    cRect_Request* request = pRenderer->Alloc<cRect_Request>();
                     pVideo->Draw_Rect(&dest, 0.9f, &color, request);
 
                     // rotation
@@ -1924,7 +1924,7 @@ void Draw_Effect_Out(Effect_Fadeout effect /* = EFFECT_OUT_RANDOM */, float spee
                     rect.m_h = Get_Random_Float(1.0f, 0.2f + (rect_size * 1.5f));
 
                     // create request
-                    cRect_Request* request = new cRect_Request();
+                    cRect_Request* request = pRenderer->Alloc<cRect_Request>();
                     pVideo->Draw_Rect(&rect, 0.9f, &color, request);
 
                     request->m_render_count = 2;
@@ -1940,7 +1940,7 @@ void Draw_Effect_Out(Effect_Fadeout effect /* = EFFECT_OUT_RANDOM */, float spee
             rect_color.blue = static_cast<uint8_t>(start_color.blue * 0.1f * color_mod);
             rect_color.alpha = static_cast<uint8_t>(rect_size * 3);
             // create request
-            cRect_Request* request = new cRect_Request();
+            cRect_Request* request = pRenderer->Alloc<cRect_Request>();
             pVideo->Draw_Rect(NULL, 0.9f, &rect_color, request);
 
             request->m_render_count = 2;
@@ -1982,7 +1982,7 @@ void Draw_Effect_In(Effect_Fadein effect /* = EFFECT_IN_RANDOM */, float speed /
             color.alpha = static_cast<uint8_t>(255 * i);
 
             // create request
-            cRect_Request* request = new cRect_Request();
+            cRect_Request* request = pRenderer->Alloc<cRect_Request>();
             pVideo->Draw_Rect(NULL, 0.9f, &color, request);
 
             // add request